@@ -0,0 +1,981 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <set>
+#include <stack>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "s21_addressable_heap.h"
+#include "s21_aligned.h"
+#include "s21_array.h"
+#include "s21_channel.h"
+#include "s21_concurrent_skip_list.h"
+#include "s21_containers.h"
+#include "s21_intrusive.h"
+#include "s21_md_array.h"
+#include "s21_mmap_vector.h"
+#include "s21_ring_buffer.h"
+#include "s21_spsc_queue.h"
+#include "s21_static_map.h"
+#include "s21_static_vector.h"
+#include "s21_unrolled_list.h"
+
+// Every s21 container of s21_containers.h, Array, and the sequence, fixed
+// size, intrusive, multidimensional and concurrent containers built on them,
+// against their std counterparts. Arguments are {n, order}: n distinct int
+// keys inserted in random, ascending or descending order. MpmcQueue,
+// PriorityQueue and WorkStealingDeque have their own bench_*.cc files.
+
+namespace {
+
+enum Order : int64_t { kRandom, kSorted, kReversed };
+
+constexpr const char *kOrderNames[] = {"random", "sorted", "reversed"};
+
+constexpr int64_t kMaxSize = 10'000'000;
+
+// BinaryTree is not self-balancing: ordered keys give a list-shaped tree
+// and quadratic inserts, so those runs stop at a size that still finishes.
+constexpr int64_t kMaxDegenerate = 10'000;
+
+std::vector<int> Keys(benchmark::State &state) {
+  std::vector<int> keys(state.range(0));
+  std::iota(keys.begin(), keys.end(), 0);
+  if (state.range(1) == kRandom) {
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+  } else if (state.range(1) == kReversed) {
+    std::reverse(keys.begin(), keys.end());
+  }
+  state.SetLabel(kOrderNames[state.range(1)]);
+  return keys;
+}
+
+// n = 10, 100, ..., up to kMaxRandom for random keys and kMaxOrdered for
+// sorted and reversed ones; 0 skips that order.
+template <int64_t kMaxRandom, int64_t kMaxOrdered>
+void Sizes(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"n", "order"});
+  for (int64_t order : {kRandom, kSorted, kReversed}) {
+    int64_t max = order == kRandom ? kMaxRandom : kMaxOrdered;
+    for (int64_t n = 10; n <= max; n *= 10) b->Args({n, order});
+  }
+}
+
+// For operations that never look at the values only random keys are run.
+constexpr auto kAll = Sizes<kMaxSize, kMaxSize>;
+constexpr auto kTree = Sizes<kMaxSize, kMaxDegenerate>;
+constexpr auto kSmall = Sizes<kMaxDegenerate, kMaxDegenerate>;
+constexpr auto kRandomOnly = Sizes<kMaxSize, 0>;
+// MmapVector runs write a file of n records each iteration.
+constexpr auto kFile = Sizes<1'000'000, 0>;
+
+int MaxThreads() {
+  unsigned threads = std::thread::hardware_concurrency();
+  return threads < 2 ? 2 : static_cast<int>(threads);
+}
+
+template <class C, class = void>
+struct IsMap : std::false_type {};
+
+template <class C>
+struct IsMap<C, std::void_t<typename C::mapped_type>> : std::true_type {};
+
+template <class C, class = void>
+struct HasContains : std::false_type {};
+
+template <class C>
+struct HasContains<C, std::void_t<decltype(std::declval<C &>().contains(0))>>
+    : std::true_type {};
+
+template <class C, class = void>
+struct HasTop : std::false_type {};
+
+template <class C>
+struct HasTop<C, std::void_t<decltype(std::declval<C &>().top())>>
+    : std::true_type {};
+
+template <class C, class = void>
+struct HasReserve : std::false_type {};
+
+template <class C>
+struct HasReserve<C, std::void_t<decltype(std::declval<C &>().reserve(0))>>
+    : std::true_type {};
+
+template <class C>
+void Insert(C &c, int key) {
+  if constexpr (IsMap<C>::value) {
+    c.insert(typename C::value_type(key, key));
+  } else {
+    c.insert(key);
+  }
+}
+
+template <class C>
+bool Contains(C &c, int key) {
+  if constexpr (HasContains<C>::value) {
+    return c.contains(key);
+  } else {
+    return c.find(key) != c.end();
+  }
+}
+
+template <class K, class V>
+int Value(const std::pair<K, V> &value) {
+  return value.first;
+}
+
+int Value(int value) { return value; }
+
+template <class C>
+C Build(const std::vector<int> &keys) {
+  C c;
+  for (int key : keys) Insert(c, key);
+  return c;
+}
+
+template <class C>
+C BuildSequence(const std::vector<int> &keys) {
+  C c;
+  for (int key : keys) c.push_back(key);
+  return c;
+}
+
+// Times op(c) on a fresh copy of prototype each iteration; making and
+// destroying the copy is not timed.
+template <class C, class Op>
+void OnFreshCopy(benchmark::State &state, const C &prototype, Op op) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    {
+      C c(prototype);
+      state.ResumeTiming();
+      op(c);
+      state.PauseTiming();
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Set and Map.
+
+template <class C>
+void AssocInsert(benchmark::State &state) {
+  std::vector<int> keys = Keys(state);
+  for (auto _ : state) {
+    C c = Build<C>(keys);
+    benchmark::DoNotOptimize(c);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C>
+void AssocFind(benchmark::State &state) {
+  std::vector<int> keys = Keys(state);
+  C c = Build<C>(keys);
+  for (auto _ : state) {
+    for (int key : keys) benchmark::DoNotOptimize(Contains(c, key));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C>
+void AssocErase(benchmark::State &state) {
+  C prototype = Build<C>(Keys(state));
+  OnFreshCopy(state, prototype, [](C &c) {
+    while (!c.empty()) c.erase(c.begin());
+  });
+}
+
+template <class C>
+void AssocIterate(benchmark::State &state) {
+  C c = Build<C>(Keys(state));
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (const auto &value : c) sum += Value(value);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C>
+void AssocCopy(benchmark::State &state) {
+  C c = Build<C>(Keys(state));
+  for (auto _ : state) {
+    C copy(c);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Merges the odd keys into a container of the even ones.
+template <class C>
+void AssocMerge(benchmark::State &state) {
+  std::vector<int> evens, odds;
+  for (int key : Keys(state)) (key % 2 == 0 ? evens : odds).push_back(key);
+  C even = Build<C>(evens);
+  C odd = Build<C>(odds);
+  for (auto _ : state) {
+    state.PauseTiming();
+    {
+      C target(even);
+      C source(odd);
+      state.ResumeTiming();
+      target.merge(source);
+      state.PauseTiming();
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Vector, AlignedVector, List, Deque, UnrolledList and RingBuffer.
+
+template <class C>
+void SeqPushBack(benchmark::State &state) {
+  std::vector<int> keys = Keys(state);
+  for (auto _ : state) {
+    C c = BuildSequence<C>(keys);
+    benchmark::DoNotOptimize(c);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C>
+void SeqPopBack(benchmark::State &state) {
+  C prototype = BuildSequence<C>(Keys(state));
+  OnFreshCopy(state, prototype, [](C &c) {
+    while (!c.empty()) c.pop_back();
+  });
+}
+
+template <class C>
+void SeqIterate(benchmark::State &state) {
+  C c = BuildSequence<C>(Keys(state));
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (int value : c) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C>
+void SeqCopy(benchmark::State &state) {
+  C c = BuildSequence<C>(Keys(state));
+  for (auto _ : state) {
+    C copy(c);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C>
+void ListSort(benchmark::State &state) {
+  C prototype = BuildSequence<C>(Keys(state));
+  OnFreshCopy(state, prototype, [](C &c) { c.sort(); });
+}
+
+// Merges two sorted lists of the even and the odd keys.
+template <class C>
+void ListMerge(benchmark::State &state) {
+  std::vector<int> evens, odds;
+  for (int64_t key = 0; key < state.range(0); ++key) {
+    (key % 2 == 0 ? evens : odds).push_back(static_cast<int>(key));
+  }
+  C even = BuildSequence<C>(evens);
+  C odd = BuildSequence<C>(odds);
+  for (auto _ : state) {
+    state.PauseTiming();
+    {
+      C target(even);
+      C source(odd);
+      state.ResumeTiming();
+      target.merge(source);
+      state.PauseTiming();
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Stack and Queue: n pushes, then n pops.
+
+template <class A>
+int Next(A &a) {
+  if constexpr (HasTop<A>::value) {
+    return a.top();
+  } else {
+    return a.front();
+  }
+}
+
+template <class A>
+void AdapterPushPop(benchmark::State &state) {
+  std::vector<int> keys = Keys(state);
+  for (auto _ : state) {
+    A a;
+    for (int key : keys) a.push(key);
+    while (!a.empty()) {
+      benchmark::DoNotOptimize(Next(a));
+      a.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Array and AlignedArray have their size in the type, so they get a few
+// fixed sizes. The arrays live on the heap, as the largest would not fit a
+// thread's stack.
+
+template <class A>
+void ArrayIterate(benchmark::State &state) {
+  auto a = std::make_unique<A>();
+  std::iota(a->begin(), a->end(), 0);
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (int value : *a) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * a->size());
+}
+
+template <class A>
+void ArrayCopy(benchmark::State &state) {
+  auto a = std::make_unique<A>();
+  auto b = std::make_unique<A>();
+  std::iota(a->begin(), a->end(), 0);
+  for (auto _ : state) {
+    *b = *a;
+    benchmark::DoNotOptimize(b->data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * a->size());
+}
+
+// StaticVector against Vector and std::vector reserved to the same
+// capacity: kFixedSize pushes into storage that never grows.
+
+constexpr int kFixedSize = 1000;
+
+template <class C>
+void FixedPushBack(benchmark::State &state) {
+  for (auto _ : state) {
+    C c;
+    if constexpr (HasReserve<C>::value) c.reserve(kFixedSize);
+    for (int i = 0; i < kFixedSize; ++i) c.push_back(i);
+    benchmark::DoNotOptimize(c.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kFixedSize);
+}
+
+// StaticMap against the hash and tree maps: a lookup of every key of a
+// kStaticMapSize table with scattered keys.
+
+constexpr std::size_t kStaticMapSize = 1000;
+
+using StaticMapEntry = s21::StaticMapEntry<std::uint32_t, std::uint32_t>;
+
+std::uint32_t StaticMapKey(std::uint32_t i) { return i * 7919 + 13; }
+
+s21::StaticMap<std::uint32_t, std::uint32_t, kStaticMapSize> BuildStaticMap() {
+  StaticMapEntry items[kStaticMapSize] = {};
+  for (std::uint32_t i = 0; i < kStaticMapSize; ++i) {
+    items[i] = {StaticMapKey(i), i};
+  }
+  return s21::StaticMap<std::uint32_t, std::uint32_t, kStaticMapSize>(items);
+}
+
+template <class M>
+M BuildLookupMap() {
+  if constexpr (std::is_same_v<M, decltype(BuildStaticMap())>) {
+    return BuildStaticMap();
+  } else {
+    M m;
+    for (std::uint32_t i = 0; i < kStaticMapSize; ++i) {
+      m.insert({StaticMapKey(i), i});
+    }
+    return m;
+  }
+}
+
+template <class M>
+void LookupFind(benchmark::State &state) {
+  const M m = BuildLookupMap<M>();
+  for (auto _ : state) {
+    for (std::uint32_t i = 0; i < kStaticMapSize; ++i) {
+      benchmark::DoNotOptimize(m.find(StaticMapKey(i)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kStaticMapSize);
+}
+
+// ConcurrentSkipListSet against std::set, alone and shared by threads. The
+// skip list cannot be copied or moved, so it is filled in place.
+
+template <class C>
+void Fill(C &c, const std::vector<int> &keys) {
+  for (int key : keys) c.insert(key);
+}
+
+template <class C>
+void SkipListInsert(benchmark::State &state) {
+  std::vector<int> keys = Keys(state);
+  for (auto _ : state) {
+    C c;
+    Fill(c, keys);
+    benchmark::DoNotOptimize(c.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class C>
+void SkipListFind(benchmark::State &state) {
+  std::vector<int> keys = Keys(state);
+  C c;
+  Fill(c, keys);
+  for (auto _ : state) {
+    for (int key : keys) benchmark::DoNotOptimize(c.find(key) != c.end());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+class LockedSet {
+ public:
+  void insert(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    set_.insert(key);
+  }
+
+  void erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    set_.erase(key);
+  }
+
+  bool contains(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return set_.find(key) != set_.end();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::set<int> set_;
+};
+
+constexpr int kSharedKeys = 1 << 16;
+
+// Every thread looks up eight keys of a shared set for each key it inserts
+// and erases again; the set holds the even keys, writers use odd ones.
+template <class Set>
+void SharedMixed(benchmark::State &state) {
+  static Set *set = nullptr;
+  if (state.thread_index() == 0) {
+    set = new Set();
+    for (int key = 0; key < kSharedKeys; key += 2) set->insert(key);
+  }
+  std::mt19937 rng(state.thread_index());
+  for (auto _ : state) {
+    for (int i = 0; i < 8; ++i) {
+      benchmark::DoNotOptimize(set->contains(rng() % kSharedKeys));
+    }
+    int key = static_cast<int>(rng() % kSharedKeys) | 1;
+    set->insert(key);
+    set->erase(key);
+  }
+  state.SetItemsProcessed(state.iterations() * 10);
+  if (state.thread_index() == 0) {
+    delete set;
+    set = nullptr;
+  }
+}
+
+// MmapVector against std::vector: n push_backs, for MmapVector into a file
+// created each iteration, and a pass over n records, for MmapVector mapped
+// read-only from that file.
+
+std::string BenchFile() {
+  return (std::filesystem::temp_directory_path() / "s21_bench_mmap.bin")
+      .string();
+}
+
+template <class C>
+void FilePushBack(benchmark::State &state) {
+  std::vector<int> keys = Keys(state);
+  for (auto _ : state) {
+    if constexpr (std::is_same_v<C, s21::MmapVector<int>>) {
+      std::remove(BenchFile().c_str());
+      C c(BenchFile());
+      for (int key : keys) c.push_back(key);
+      benchmark::DoNotOptimize(c.data());
+    } else {
+      C c;
+      for (int key : keys) c.push_back(key);
+      benchmark::DoNotOptimize(c.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  std::remove(BenchFile().c_str());
+}
+
+template <class C>
+void FileIterate(benchmark::State &state) {
+  std::vector<int> keys = Keys(state);
+  auto run = [&state](const auto &c) {
+    for (auto _ : state) {
+      int64_t sum = 0;
+      for (int value : c) sum += value;
+      benchmark::DoNotOptimize(sum);
+    }
+  };
+  if constexpr (std::is_same_v<C, s21::MmapVector<int>>) {
+    std::remove(BenchFile().c_str());
+    {
+      C writer(BenchFile());
+      for (int key : keys) writer.push_back(key);
+    }
+    run(C::open_readonly(BenchFile()));
+    std::remove(BenchFile().c_str());
+  } else {
+    run(C(keys.begin(), keys.end()));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// IntrusiveList and IntrusiveSet against std::list and std::set: linking n
+// objects that already exist, a pass or a lookup of each, and unlinking
+// them. The std containers allocate a node per element instead.
+
+struct Item : s21::list_hook<>, s21::tree_hook<> {
+  explicit Item(int key) : key(key) {}
+
+  bool operator<(const Item &other) const { return key < other.key; }
+
+  int key;
+};
+
+template <class L>
+void LinkIterate(benchmark::State &state) {
+  std::vector<int> keys = Keys(state);
+  std::vector<Item> items(keys.begin(), keys.end());
+  for (auto _ : state) {
+    L l;
+    if constexpr (std::is_same_v<L, std::list<int>>) {
+      for (int key : keys) l.push_back(key);
+      int64_t sum = 0;
+      for (int value : l) sum += value;
+      benchmark::DoNotOptimize(sum);
+    } else {
+      for (Item &item : items) l.push_back(item);
+      int64_t sum = 0;
+      for (const Item &item : l) sum += item.key;
+      benchmark::DoNotOptimize(sum);
+    }
+    l.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class S>
+void LinkFind(benchmark::State &state) {
+  std::vector<int> keys = Keys(state);
+  std::vector<Item> items(keys.begin(), keys.end());
+  for (auto _ : state) {
+    S s;
+    if constexpr (std::is_same_v<S, std::set<int>>) {
+      for (int key : keys) s.insert(key);
+      for (int key : keys) benchmark::DoNotOptimize(s.find(key));
+    } else {
+      for (Item &item : items) s.insert(item);
+      for (int key : keys) benchmark::DoNotOptimize(s.find(Item(key)));
+    }
+    s.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// AddressableHeap against std::priority_queue with lazy deletion, as in
+// Dijkstra: n pushes, n key decreases on random elements of a min-heap, then
+// popping everything. The std heap pushes a new entry for each decrease and
+// skips the stale ones as they come up.
+
+class LazyHeap {
+ public:
+  using handle_type = std::size_t;
+
+  handle_type push(int key) {
+    keys_.push_back(key);
+    heap_.push({key, keys_.size() - 1});
+    return keys_.size() - 1;
+  }
+
+  void lower(handle_type handle, int key) {
+    keys_[handle] = key;
+    heap_.push({key, handle});
+  }
+
+  bool empty() {
+    Skip();
+    return heap_.empty();
+  }
+
+  int top() {
+    Skip();
+    return heap_.top().first;
+  }
+
+  void pop() {
+    Skip();
+    keys_[heap_.top().second] = INT_MIN;
+    heap_.pop();
+  }
+
+ private:
+  using Entry = std::pair<int, handle_type>;
+
+  void Skip() {
+    while (!heap_.empty() && heap_.top().first != keys_[heap_.top().second]) {
+      heap_.pop();
+    }
+  }
+
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap_;
+  std::vector<int> keys_;
+};
+
+class IndexedHeap {
+ public:
+  using handle_type = s21::AddressableHeap<int, std::greater<int>>::handle_type;
+
+  handle_type push(int key) { return heap_.push(key); }
+
+  // The heap is a min-heap, so lowering a key moves it up: increase_key.
+  void lower(handle_type handle, int key) { heap_.increase_key(handle, key); }
+
+  bool empty() const { return heap_.empty(); }
+
+  int top() const { return heap_.top(); }
+
+  void pop() { heap_.pop(); }
+
+ private:
+  s21::AddressableHeap<int, std::greater<int>> heap_;
+};
+
+template <class H>
+void HeapDecreaseKey(benchmark::State &state) {
+  std::vector<int> keys = Keys(state);
+  std::mt19937 rng(7);
+  std::vector<std::pair<std::size_t, int>> decreases(keys.size());
+  for (auto &decrease : decreases) {
+    decrease = {rng() % keys.size(), static_cast<int>(rng() % 16) + 1};
+  }
+  for (auto _ : state) {
+    H heap;
+    std::vector<typename H::handle_type> handles;
+    handles.reserve(keys.size());
+    std::vector<int> current(keys);
+    for (int key : keys) handles.push_back(heap.push(key));
+    for (auto [index, by] : decreases) {
+      current[index] -= by;
+      heap.lower(handles[index], current[index]);
+    }
+    while (!heap.empty()) {
+      benchmark::DoNotOptimize(heap.top());
+      heap.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// MdArray and Tensor against a flat std::vector and std::array indexed by
+// hand: filling an n x n matrix and summing it row by row.
+
+class FlatMatrix {
+ public:
+  FlatMatrix(std::size_t rows, std::size_t cols)
+      : cols_(cols), data_(rows * cols) {}
+
+  int &operator()(std::size_t i, std::size_t j) { return data_[i * cols_ + j]; }
+
+ private:
+  std::size_t cols_;
+  std::vector<int> data_;
+};
+
+constexpr std::size_t kTensorSide = 64;
+
+class FixedMatrix {
+ public:
+  int &operator()(std::size_t i, std::size_t j) {
+    return data_[i * kTensorSide + j];
+  }
+
+ private:
+  std::array<int, kTensorSide * kTensorSide> data_{};
+};
+
+template <class M>
+void MatrixSum(M &m, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) m(i, j) = static_cast<int>(i + j);
+  }
+  int64_t sum = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) sum += m(i, j);
+  }
+  benchmark::DoNotOptimize(sum);
+}
+
+template <class M>
+void MatrixFillSum(benchmark::State &state) {
+  std::size_t n = state.range(0);
+  M m(n, n);
+  for (auto _ : state) MatrixSum(m, n);
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <class M>
+void FixedMatrixFillSum(benchmark::State &state) {
+  auto m = std::make_unique<M>();
+  for (auto _ : state) MatrixSum(*m, kTensorSide);
+  state.SetItemsProcessed(state.iterations() * kTensorSide * kTensorSide);
+}
+
+// SpscQueue and Channel against a mutex-guarded std::queue: one producer
+// thread hands values to one consumer thread through a queue of
+// kHandoffCapacity slots. Channel blocks when full or empty, the others are
+// polled.
+
+constexpr std::size_t kHandoffCapacity = 1024;
+
+class LockedStdQueue {
+ public:
+  explicit LockedStdQueue(std::size_t capacity) : capacity_(capacity) {}
+
+  bool try_push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == capacity_) return false;
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(int &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::size_t capacity_;
+  std::mutex mutex_;
+  std::queue<int> queue_;
+};
+
+using IntChannel = s21::Channel<int>;
+
+template <class Q>
+void Handoff(benchmark::State &state) {
+  static Q *queue = nullptr;
+  if (state.thread_index() == 0) queue = new Q(kHandoffCapacity);
+  int value = 0;
+  for (auto _ : state) {
+    if (state.thread_index() == 0) {
+      if constexpr (std::is_same_v<Q, IntChannel>) {
+        queue->push(value);
+      } else {
+        while (!queue->try_push(value)) std::this_thread::yield();
+      }
+      ++value;
+    } else {
+      if constexpr (std::is_same_v<Q, IntChannel>) {
+        queue->pop(value);
+      } else {
+        while (!queue->try_pop(value)) std::this_thread::yield();
+      }
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  if (state.thread_index() == 1) state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    delete queue;
+    queue = nullptr;
+  }
+}
+
+using S21Set = s21::Set<int>;
+using StdSet = std::set<int>;
+using S21Map = s21::Map<int, int>;
+using StdMap = std::map<int, int>;
+using Unrolled = s21::UnrolledList<int>;
+using Ring = s21::RingBuffer<int>;
+using StaticVec = s21::StaticVector<int, kFixedSize>;
+using StaticLookup = decltype(BuildStaticMap());
+using HashLookup = std::unordered_map<std::uint32_t, std::uint32_t>;
+using TreeLookup = std::map<std::uint32_t, std::uint32_t>;
+using SkipSet = s21::ConcurrentSkipListSet<int>;
+using AlignedVec = s21::AlignedVector<int>;
+using ItemList = s21::IntrusiveList<Item>;
+using ItemSet = s21::IntrusiveSet<Item>;
+using Matrix = s21::MdArray<int, 2>;
+using FixedTensor = s21::Tensor<int, kTensorSide, kTensorSide>;
+using Spsc = s21::SpscQueue<int>;
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(AssocInsert, S21Set)->Apply(kTree);
+BENCHMARK_TEMPLATE(AssocInsert, StdSet)->Apply(kAll);
+BENCHMARK_TEMPLATE(AssocInsert, S21Map)->Apply(kTree);
+BENCHMARK_TEMPLATE(AssocInsert, StdMap)->Apply(kAll);
+BENCHMARK_TEMPLATE(AssocFind, S21Set)->Apply(kTree);
+BENCHMARK_TEMPLATE(AssocFind, StdSet)->Apply(kAll);
+// Map::contains walks the elements in order.
+BENCHMARK_TEMPLATE(AssocFind, S21Map)->Apply(kSmall);
+BENCHMARK_TEMPLATE(AssocFind, StdMap)->Apply(kAll);
+BENCHMARK_TEMPLATE(AssocErase, S21Set)->Apply(kTree);
+BENCHMARK_TEMPLATE(AssocErase, StdSet)->Apply(kAll);
+BENCHMARK_TEMPLATE(AssocErase, S21Map)->Apply(kTree);
+BENCHMARK_TEMPLATE(AssocErase, StdMap)->Apply(kAll);
+BENCHMARK_TEMPLATE(AssocIterate, S21Set)->Apply(kTree);
+BENCHMARK_TEMPLATE(AssocIterate, StdSet)->Apply(kAll);
+BENCHMARK_TEMPLATE(AssocIterate, S21Map)->Apply(kTree);
+BENCHMARK_TEMPLATE(AssocIterate, StdMap)->Apply(kAll);
+BENCHMARK_TEMPLATE(AssocCopy, S21Set)->Apply(kTree);
+BENCHMARK_TEMPLATE(AssocCopy, StdSet)->Apply(kAll);
+BENCHMARK_TEMPLATE(AssocCopy, S21Map)->Apply(kTree);
+BENCHMARK_TEMPLATE(AssocCopy, StdMap)->Apply(kAll);
+BENCHMARK_TEMPLATE(AssocMerge, S21Set)->Apply(kTree);
+BENCHMARK_TEMPLATE(AssocMerge, StdSet)->Apply(kAll);
+// Map::merge checks every key with Map::contains.
+BENCHMARK_TEMPLATE(AssocMerge, S21Map)->Apply(kSmall);
+BENCHMARK_TEMPLATE(AssocMerge, StdMap)->Apply(kAll);
+
+BENCHMARK_TEMPLATE(SeqPushBack, s21::Vector<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPushBack, std::vector<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPushBack, AlignedVec)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPushBack, s21::List<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPushBack, std::list<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPushBack, s21::Deque<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPushBack, std::deque<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPushBack, Unrolled)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPushBack, Ring)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPopBack, s21::Vector<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPopBack, std::vector<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPopBack, AlignedVec)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPopBack, s21::List<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPopBack, std::list<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPopBack, s21::Deque<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPopBack, std::deque<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPopBack, Unrolled)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqPopBack, Ring)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqIterate, s21::Vector<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqIterate, std::vector<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqIterate, AlignedVec)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqIterate, s21::List<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqIterate, std::list<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqIterate, s21::Deque<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqIterate, std::deque<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqIterate, Unrolled)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqIterate, Ring)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqCopy, s21::Vector<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqCopy, std::vector<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqCopy, AlignedVec)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqCopy, s21::List<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqCopy, std::list<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqCopy, s21::Deque<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqCopy, std::deque<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqCopy, Unrolled)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(SeqCopy, Ring)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(ListSort, s21::List<int>)->Apply(kAll);
+BENCHMARK_TEMPLATE(ListSort, std::list<int>)->Apply(kAll);
+BENCHMARK_TEMPLATE(ListSort, Unrolled)->Apply(kAll);
+BENCHMARK_TEMPLATE(ListMerge, s21::List<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(ListMerge, std::list<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(ListMerge, Unrolled)->Apply(kRandomOnly);
+
+BENCHMARK_TEMPLATE(AdapterPushPop, s21::Stack<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(AdapterPushPop, std::stack<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(AdapterPushPop, s21::Queue<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(AdapterPushPop, std::queue<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(AdapterPushPop, s21::Stack<int, Ring>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(AdapterPushPop, s21::Queue<int, Ring>)->Apply(kRandomOnly);
+
+BENCHMARK_TEMPLATE(ArrayIterate, s21::Array<int, 1000>);
+BENCHMARK_TEMPLATE(ArrayIterate, std::array<int, 1000>);
+BENCHMARK_TEMPLATE(ArrayIterate, s21::AlignedArray<int, 1000>);
+BENCHMARK_TEMPLATE(ArrayIterate, s21::Array<int, 1000000>);
+BENCHMARK_TEMPLATE(ArrayIterate, std::array<int, 1000000>);
+BENCHMARK_TEMPLATE(ArrayIterate, s21::AlignedArray<int, 1000000>);
+BENCHMARK_TEMPLATE(ArrayCopy, s21::Array<int, 1000>);
+BENCHMARK_TEMPLATE(ArrayCopy, std::array<int, 1000>);
+BENCHMARK_TEMPLATE(ArrayCopy, s21::AlignedArray<int, 1000>);
+BENCHMARK_TEMPLATE(ArrayCopy, s21::Array<int, 1000000>);
+BENCHMARK_TEMPLATE(ArrayCopy, std::array<int, 1000000>);
+BENCHMARK_TEMPLATE(ArrayCopy, s21::AlignedArray<int, 1000000>);
+
+BENCHMARK_TEMPLATE(FixedPushBack, StaticVec);
+BENCHMARK_TEMPLATE(FixedPushBack, s21::Vector<int>);
+BENCHMARK_TEMPLATE(FixedPushBack, std::vector<int>);
+
+BENCHMARK_TEMPLATE(LookupFind, StaticLookup);
+BENCHMARK_TEMPLATE(LookupFind, HashLookup);
+BENCHMARK_TEMPLATE(LookupFind, TreeLookup);
+
+BENCHMARK_TEMPLATE(SkipListInsert, SkipSet)->Apply(kAll);
+BENCHMARK_TEMPLATE(SkipListInsert, StdSet)->Apply(kAll);
+BENCHMARK_TEMPLATE(SkipListFind, SkipSet)->Apply(kAll);
+BENCHMARK_TEMPLATE(SkipListFind, StdSet)->Apply(kAll);
+BENCHMARK_TEMPLATE(SharedMixed, SkipSet)
+    ->ThreadRange(1, MaxThreads())
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(SharedMixed, LockedSet)
+    ->ThreadRange(1, MaxThreads())
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(FilePushBack, s21::MmapVector<int>)->Apply(kFile);
+BENCHMARK_TEMPLATE(FilePushBack, std::vector<int>)->Apply(kFile);
+BENCHMARK_TEMPLATE(FileIterate, s21::MmapVector<int>)->Apply(kFile);
+BENCHMARK_TEMPLATE(FileIterate, std::vector<int>)->Apply(kFile);
+
+BENCHMARK_TEMPLATE(LinkIterate, ItemList)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(LinkIterate, std::list<int>)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(LinkFind, ItemSet)->Apply(kTree);
+BENCHMARK_TEMPLATE(LinkFind, std::set<int>)->Apply(kAll);
+
+BENCHMARK_TEMPLATE(HeapDecreaseKey, IndexedHeap)->Apply(kRandomOnly);
+BENCHMARK_TEMPLATE(HeapDecreaseKey, LazyHeap)->Apply(kRandomOnly);
+
+BENCHMARK_TEMPLATE(MatrixFillSum, Matrix)
+    ->ArgName("n")
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(2048);
+BENCHMARK_TEMPLATE(MatrixFillSum, FlatMatrix)
+    ->ArgName("n")
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(2048);
+BENCHMARK_TEMPLATE(FixedMatrixFillSum, FixedTensor);
+BENCHMARK_TEMPLATE(FixedMatrixFillSum, FixedMatrix);
+
+BENCHMARK_TEMPLATE(Handoff, Spsc)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(Handoff, IntChannel)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(Handoff, LockedStdQueue)->Threads(2)->UseRealTime();
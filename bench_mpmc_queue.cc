@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <thread>
+
+#include "s21_mpmc_queue.h"
+#include "s21_queue.h"
+
+namespace {
+
+constexpr std::size_t kCapacity = 1024;
+
+int MaxThreads() {
+  unsigned threads = std::thread::hardware_concurrency();
+  return threads < 2 ? 2 : static_cast<int>(threads);
+}
+
+class LockedQueue {
+ public:
+  bool try_push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == kCapacity) return false;
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(int &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Queue<int> queue_;
+};
+
+// Every thread alternates a push and a pop on one shared queue, so the
+// producer and consumer roles are spread over all threads.
+template <class Queue, class... Args>
+void PushPop(benchmark::State &state, Args... args) {
+  static Queue *queue = nullptr;
+  if (state.thread_index() == 0) queue = new Queue(args...);
+  int value = 0;
+  for (auto _ : state) {
+    while (!queue->try_push(value)) std::this_thread::yield();
+    while (!queue->try_pop(value)) std::this_thread::yield();
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+  if (state.thread_index() == 0) {
+    delete queue;
+    queue = nullptr;
+  }
+}
+
+void BM_MpmcQueue(benchmark::State &state) {
+  PushPop<s21::MpmcQueue<int>>(state, kCapacity);
+}
+
+void BM_BlockingMpmcQueue(benchmark::State &state) {
+  PushPop<s21::BlockingMpmcQueue<int>>(state, kCapacity);
+}
+
+void BM_MutexQueue(benchmark::State &state) { PushPop<LockedQueue>(state); }
+
+}  // namespace
+
+BENCHMARK(BM_MpmcQueue)->ThreadRange(1, MaxThreads())->UseRealTime();
+BENCHMARK(BM_BlockingMpmcQueue)->ThreadRange(1, MaxThreads())->UseRealTime();
+BENCHMARK(BM_MutexQueue)->ThreadRange(1, MaxThreads())->UseRealTime();
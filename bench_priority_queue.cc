@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "s21_priority_queue.h"
+
+namespace {
+
+std::vector<int> RandomValues(std::size_t n) {
+  std::mt19937 gen(7);
+  std::vector<int> values(n);
+  for (int &value : values) value = static_cast<int>(gen());
+  return values;
+}
+
+// Heapifies n random values and pops them all.
+template <class Queue>
+void HeapifyPopAll(benchmark::State &state) {
+  std::vector<int> values = RandomValues(state.range(0));
+  for (auto _ : state) {
+    Queue q(values.begin(), values.end());
+    while (!q.empty()) {
+      benchmark::DoNotOptimize(q.top());
+      q.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Pushes n random values one by one and pops them all.
+template <class Queue>
+void PushPopAll(benchmark::State &state) {
+  std::vector<int> values = RandomValues(state.range(0));
+  for (auto _ : state) {
+    Queue q;
+    for (int value : values) q.push(value);
+    while (!q.empty()) {
+      benchmark::DoNotOptimize(q.top());
+      q.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using Binary = s21::PriorityQueue<int, s21::Vector<int>, std::less<int>, 2>;
+using FourAry = s21::PriorityQueue<int>;
+using EightAry = s21::PriorityQueue<int, s21::Vector<int>, std::less<int>, 8>;
+using Std = std::priority_queue<int>;
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(HeapifyPopAll, Binary)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(HeapifyPopAll, FourAry)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(HeapifyPopAll, EightAry)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(HeapifyPopAll, Std)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(PushPopAll, Binary)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(PushPopAll, FourAry)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(PushPopAll, Std)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <thread>
+
+#include "s21_deque.h"
+#include "s21_work_stealing_deque.h"
+
+namespace {
+
+int MaxThreads() {
+  unsigned threads = std::thread::hardware_concurrency();
+  return threads < 2 ? 2 : static_cast<int>(threads);
+}
+
+class LockedDeque {
+ public:
+  void push_bottom(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    deque_.push_back(value);
+  }
+
+  bool pop_bottom(int &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (deque_.empty()) return false;
+    value = deque_.back();
+    deque_.pop_back();
+    return true;
+  }
+
+  bool steal_top(int &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (deque_.empty()) return false;
+    value = deque_.front();
+    deque_.pop_front();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Deque<int> deque_;
+};
+
+// Thread 0 is the owner and pushes two tasks, then pops one back, per
+// iteration, draining itself whenever no thief keeps up; every other thread
+// keeps stealing. Only the owner's operations are counted, so the numbers
+// show what thieves cost the owner.
+template <class Deque>
+void OwnerWithThieves(benchmark::State &state) {
+  static Deque *deque = nullptr;
+  if (state.thread_index() == 0) deque = new Deque();
+  int value = 0;
+  int pending = 0;
+  for (auto _ : state) {
+    if (state.thread_index() == 0) {
+      deque->push_bottom(value);
+      deque->push_bottom(value + 1);
+      pending = deque->pop_bottom(value) ? pending + 1 : 0;
+      if (pending > 1024) {
+        while (deque->pop_bottom(value)) {
+        }
+        pending = 0;
+      }
+    } else if (!deque->steal_top(value)) {
+      std::this_thread::yield();
+    }
+    benchmark::DoNotOptimize(value);
+  }
+  if (state.thread_index() == 0) {
+    state.SetItemsProcessed(state.iterations() * 3);
+    delete deque;
+    deque = nullptr;
+  }
+}
+
+void BM_WorkStealingDeque(benchmark::State &state) {
+  OwnerWithThieves<s21::WorkStealingDeque<int>>(state);
+}
+
+void BM_MutexDeque(benchmark::State &state) {
+  OwnerWithThieves<LockedDeque>(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_WorkStealingDeque)->ThreadRange(1, MaxThreads())->UseRealTime();
+BENCHMARK(BM_MutexDeque)->ThreadRange(1, MaxThreads())->UseRealTime();
@@ -0,0 +1,271 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_ADDRESSABLE_HEAP_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_ADDRESSABLE_HEAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Indexed d-ary heap whose push returns a handle to the element, so its key
+// can later be changed or the element removed in O(log n). The entries live
+// in the heap array itself, each tagged with the id of its handle; a side
+// table maps ids to array positions and is patched on every move.
+//
+// As in PriorityQueue the top is the greatest element under Compare, and
+// "increase" means moving towards the top. For a min-heap on distances
+// (Compare = std::greater) lowering a distance is therefore increase_key.
+//
+// A handle stays valid until its element is popped or erased. Its id may
+// then be reused by a later push, but each reuse bumps the id's generation,
+// so the old handle stays stale: contains() is false and the accessors
+// throw.
+template <class T, class Compare = std::less<T>, std::size_t Arity = 4>
+class AddressableHeap {
+  static_assert(Arity >= 2, "s21::AddressableHeap needs at least two children");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using value_compare = Compare;
+
+  class handle_type {
+    friend AddressableHeap;
+
+   public:
+    handle_type() = default;
+
+    bool operator==(const handle_type &other) const {
+      return id_ == other.id_ && generation_ == other.generation_;
+    }
+
+    bool operator!=(const handle_type &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    handle_type(size_type id, size_type generation)
+        : id_(id), generation_(generation) {}
+
+    size_type id_ = kNone;
+    size_type generation_ = 0;
+  };
+
+  AddressableHeap() : AddressableHeap(Compare()) {}
+
+  explicit AddressableHeap(const Compare &comp) : comp(comp) {}
+
+  AddressableHeap(const AddressableHeap &h) = default;
+
+  AddressableHeap(AddressableHeap &&h) = default;
+
+  ~AddressableHeap() {}
+
+  AddressableHeap &operator=(const AddressableHeap &h) = default;
+
+  AddressableHeap &operator=(AddressableHeap &&h) = default;
+
+  const_reference top() const { return heap_.front().value; }
+
+  handle_type top_handle() const { return Handle(heap_.front().id); }
+
+  bool empty() const { return heap_.empty(); }
+
+  size_type size() const { return heap_.size(); }
+
+  void reserve(size_type capacity) {
+    heap_.reserve(capacity);
+    position_.reserve(capacity);
+  }
+
+  handle_type push(const_reference value) { return emplace(value); }
+
+  handle_type push(value_type &&value) { return emplace(std::move(value)); }
+
+  template <class... Args>
+  handle_type emplace(Args &&...args) {
+    size_type id;
+    if (free_.empty()) {
+      id = position_.size();
+      position_.push_back(Slot{kNone, 0});
+    } else {
+      id = free_.back();
+      free_.pop_back();
+    }
+    try {
+      heap_.push_back(Entry{value_type(std::forward<Args>(args)...), id});
+    } catch (...) {
+      free_.push_back(id);
+      throw;
+    }
+    size_type last = heap_.size() - 1;
+    position_[id].index = last;
+    SiftUp(last);
+    return Handle(id);
+  }
+
+  void pop() {
+    if (!heap_.empty()) Remove(0);
+  }
+
+  bool contains(handle_type handle) const {
+    return handle.id_ < position_.size() &&
+           position_[handle.id_].index != kNone &&
+           position_[handle.id_].generation == handle.generation_;
+  }
+
+  const_reference operator[](handle_type handle) const {
+    return heap_[Position(handle)].value;
+  }
+
+  // Replaces the key, sifting in whichever direction it moved.
+  void update(handle_type handle, const_reference value) {
+    size_type index = Position(handle);
+    bool up = comp(heap_[index].value, value);
+    heap_[index].value = value;
+    if (up) {
+      SiftUp(index);
+    } else {
+      SiftDown(index);
+    }
+  }
+
+  // The new key must not rank below the old one.
+  void increase_key(handle_type handle, const_reference value) {
+    size_type index = Position(handle);
+    if (comp(value, heap_[index].value)) {
+      throw std::invalid_argument(
+          "s21::AddressableHeap::increase_key lowers the key");
+    }
+    heap_[index].value = value;
+    SiftUp(index);
+  }
+
+  // The new key must not rank above the old one.
+  void decrease_key(handle_type handle, const_reference value) {
+    size_type index = Position(handle);
+    if (comp(heap_[index].value, value)) {
+      throw std::invalid_argument(
+          "s21::AddressableHeap::decrease_key raises the key");
+    }
+    heap_[index].value = value;
+    SiftDown(index);
+  }
+
+  void erase(handle_type handle) { Remove(Position(handle)); }
+
+  // Keeps the ids, retired, so that handles from before stay stale.
+  void clear() {
+    for (const Entry &entry : heap_) Retire(entry.id);
+    heap_.clear();
+  }
+
+  void swap(AddressableHeap &other) {
+    std::swap(heap_, other.heap_);
+    std::swap(position_, other.position_);
+    std::swap(free_, other.free_);
+    std::swap(comp, other.comp);
+  }
+
+ protected:
+  Compare comp;
+
+ private:
+  static constexpr size_type kNone = std::numeric_limits<size_type>::max();
+
+  struct Entry {
+    value_type value;
+    size_type id;
+  };
+
+  // Heap index of each handle id, kNone once its element is gone, and the
+  // number of times the id has been retired.
+  struct Slot {
+    size_type index;
+    size_type generation;
+  };
+
+  std::vector<Entry> heap_;
+  std::vector<Slot> position_;
+  std::vector<size_type> free_;
+
+  size_type Position(handle_type handle) const {
+    if (!contains(handle)) {
+      throw std::out_of_range("s21::AddressableHeap: stale handle");
+    }
+    return position_[handle.id_].index;
+  }
+
+  handle_type Handle(size_type id) const {
+    return handle_type(id, position_[id].generation);
+  }
+
+  void Retire(size_type id) {
+    position_[id].index = kNone;
+    ++position_[id].generation;
+    free_.push_back(id);
+  }
+
+  void Place(size_type index, Entry &&entry) {
+    position_[entry.id].index = index;
+    heap_[index] = std::move(entry);
+  }
+
+  // Moves the last entry into the slot at index and restores the heap around
+  // it.
+  void Remove(size_type index) {
+    size_type id = heap_[index].id;
+    size_type last = heap_.size() - 1;
+    if (index != last) {
+      Place(index, std::move(heap_[last]));
+      heap_.pop_back();
+      if (index > 0 && comp(heap_[(index - 1) / Arity].value,
+                            heap_[index].value)) {
+        SiftUp(index);
+      } else {
+        SiftDown(index);
+      }
+    } else {
+      heap_.pop_back();
+    }
+    Retire(id);
+  }
+
+  void SiftUp(size_type index) {
+    Entry entry = std::move(heap_[index]);
+    while (index > 0) {
+      size_type parent = (index - 1) / Arity;
+      if (!comp(heap_[parent].value, entry.value)) break;
+      Place(index, std::move(heap_[parent]));
+      index = parent;
+    }
+    Place(index, std::move(entry));
+  }
+
+  void SiftDown(size_type index) {
+    Entry entry = std::move(heap_[index]);
+    size_type n = heap_.size();
+    for (;;) {
+      size_type child = index * Arity + 1;
+      if (child >= n) break;
+      size_type end = child + Arity < n ? child + Arity : n;
+      size_type best = child;
+      for (++child; child < end; ++child) {
+        if (comp(heap_[best].value, heap_[child].value)) best = child;
+      }
+      if (!comp(entry.value, heap_[best].value)) break;
+      Place(index, std::move(heap_[best]));
+      index = best;
+    }
+    Place(index, std::move(entry));
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_ADDRESSABLE_HEAP_H_
@@ -0,0 +1,174 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_ALIGNED_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_ALIGNED_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_node_pool.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+namespace aligned {
+
+constexpr size_t RoundUp(size_t bytes, size_t align) {
+  return (bytes + align - 1) / align * align;
+}
+
+}  // namespace aligned
+
+// Allocator whose blocks start on an Align boundary and are padded up to the
+// next one, so a SIMD kernel may load a full Align-wide vector at any aligned
+// offset below the end of the elements. The padding is readable but holds
+// unspecified bytes.
+template <class T, size_t Align = kCacheLineSize>
+class AlignedAllocator {
+  static_assert((Align & (Align - 1)) == 0 && Align >= alignof(T),
+                "s21::AlignedAllocator needs a power of two >= alignof(T)");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  template <class U>
+  struct rebind {
+    using other = AlignedAllocator<U, Align>;
+  };
+
+  static constexpr size_t alignment = Align;
+
+  AlignedAllocator() noexcept = default;
+
+  template <class U>
+  AlignedAllocator(const AlignedAllocator<U, Align> &) noexcept {}
+
+  T *allocate(size_type n) {
+    if (n > max_size()) throw std::bad_array_new_length();
+    return static_cast<T *>(::operator new(
+        aligned::RoundUp(n * sizeof(T), Align), std::align_val_t(Align)));
+  }
+
+  void deallocate(T *ptr, size_type) noexcept {
+    ::operator delete(ptr, std::align_val_t(Align));
+  }
+
+  size_type max_size() const noexcept {
+    return (std::numeric_limits<size_type>::max() - Align) / sizeof(T);
+  }
+
+  template <class U>
+  bool operator==(const AlignedAllocator<U, Align> &) const noexcept {
+    return true;
+  }
+
+  template <class U>
+  bool operator!=(const AlignedAllocator<U, Align> &) const noexcept {
+    return false;
+  }
+};
+
+// Vector whose data() is Align-aligned and whose storage is padded to a
+// multiple of Align bytes.
+template <class T, size_t Align = kCacheLineSize>
+using AlignedVector = Vector<T, AlignedAllocator<T, Align>>;
+
+// Array whose data() is Align-aligned, followed by value-initialized padding
+// elements up to the next Align boundary: a kernel can run in full
+// Align-wide steps up to padded_size() and needs no scalar remainder loop.
+// The padding belongs to the kernel; size(), end() and fill cover only the
+// N elements.
+template <class T, const size_t N, size_t Align = kCacheLineSize>
+class AlignedArray {
+  static_assert((Align & (Align - 1)) == 0 && Align >= alignof(T),
+                "s21::AlignedArray needs a power of two >= alignof(T)");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using Iterator = T *;
+  using const_Iterator = const T *;
+  using size_type = size_t;
+
+  static constexpr size_type kPaddedSize =
+      (aligned::RoundUp(N * sizeof(T), Align) + sizeof(T) - 1) / sizeof(T);
+
+  AlignedArray() {
+    for (size_type i = N; i < kPaddedSize; ++i) array_[i] = value_type();
+  }
+
+  AlignedArray(std::initializer_list<value_type> const &items)
+      : AlignedArray() {
+    if (items.size() > N) {
+      throw std::out_of_range("s21::AlignedArray::limit is exceeded");
+    }
+    size_type i = 0;
+    for (const_reference item : items) array_[i++] = item;
+    for (; i < N; ++i) array_[i] = value_type();
+  }
+
+  reference at(size_type pos) {
+    if (pos >= N) {
+      throw std::out_of_range("s21::AlignedArray::limit is exceeded");
+    }
+    return array_[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= N) {
+      throw std::out_of_range("s21::AlignedArray::limit is exceeded");
+    }
+    return array_[pos];
+  }
+
+  reference operator[](size_type pos) { return array_[pos]; }
+
+  const_reference operator[](size_type pos) const { return array_[pos]; }
+
+  reference front() { return array_[0]; }
+
+  const_reference front() const { return array_[0]; }
+
+  reference back() { return array_[N - 1]; }
+
+  const_reference back() const { return array_[N - 1]; }
+
+  Iterator data() noexcept { return array_; }
+
+  const_Iterator data() const noexcept { return array_; }
+
+  Iterator begin() noexcept { return array_; }
+
+  Iterator end() noexcept { return array_ + N; }
+
+  const_Iterator begin() const noexcept { return array_; }
+
+  const_Iterator end() const noexcept { return array_ + N; }
+
+  bool empty() const noexcept { return N == 0; }
+
+  size_type size() const noexcept { return N; }
+
+  size_type max_size() const noexcept { return N; }
+
+  size_type padded_size() const noexcept { return kPaddedSize; }
+
+  void swap(AlignedArray &other) {
+    for (size_type i = 0; i < N; ++i) std::swap(array_[i], other.array_[i]);
+  }
+
+  void fill(const_reference value) {
+    for (size_type i = 0; i < N; ++i) array_[i] = value;
+  }
+
+ private:
+  alignas(Align) value_type array_[kPaddedSize == 0 ? 1 : kPaddedSize];
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_ALIGNED_H_
@@ -0,0 +1,92 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_ALLOC_BUDGET_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_ALLOC_BUDGET_H_
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+
+#include "s21_alloc_stats.h"
+
+namespace s21 {
+
+// Limits on what one test may allocate through TrackingAllocator. Peak is
+// measured above the live bytes at the start of the test.
+struct AllocBudget {
+  std::uint64_t max_allocations = std::numeric_limits<std::uint64_t>::max();
+  std::uint64_t max_bytes = std::numeric_limits<std::uint64_t>::max();
+  std::int64_t max_peak_bytes = std::numeric_limits<std::int64_t>::max();
+  std::int64_t max_leaked_bytes = 0;
+};
+
+namespace alloc_stats {
+
+inline AllocBudget &CurrentBudget() {
+  static AllocBudget budget;
+  return budget;
+}
+
+}  // namespace alloc_stats
+
+// Overrides the listener's default budget for the running test.
+inline void SetAllocBudget(const AllocBudget &budget) {
+  alloc_stats::CurrentBudget() = budget;
+}
+
+// Checks every test against its AllocBudget. By default a test may allocate
+// anything but must free all of it. Register it in main:
+//   testing::UnitTest::GetInstance()->listeners().Append(
+//       new s21::AllocBudgetListener());
+// gtest calls OnTestEnd in reverse order of registration, so an appended
+// listener runs before the default result printer and a budget failure
+// shows up in the test's own result. Only containers on a TrackingAllocator
+// are seen, i.e. all of them when built with S21_TRACK_ALLOCATIONS.
+class AllocBudgetListener : public testing::EmptyTestEventListener {
+ public:
+  explicit AllocBudgetListener(const AllocBudget &budget = AllocBudget(),
+                               bool print_report = true)
+      : default_(budget), print_report_(print_report), resets_(0) {}
+
+  void OnTestStart(const testing::TestInfo &) override {
+    SetAllocBudget(default_);
+    alloc_stats::Registry::Total().ResetPeak();
+    resets_ = alloc_stats::Resets().load(std::memory_order_relaxed);
+    start_ = alloc_stats::Total();
+  }
+
+  void OnTestEnd(const testing::TestInfo &) override {
+    const AllocBudget &budget = alloc_stats::CurrentBudget();
+    AllocStats end = alloc_stats::Total();
+    // A test that calls alloc_stats::Reset() restarts the counts, so only
+    // live and peak bytes, which Reset keeps, can be checked for it.
+    if (alloc_stats::Resets().load(std::memory_order_relaxed) == resets_) {
+      EXPECT_LE(end.allocations - start_.allocations, budget.max_allocations)
+          << "allocation count over budget";
+      EXPECT_LE(end.bytes_allocated - start_.bytes_allocated,
+                budget.max_bytes)
+          << "allocated bytes over budget";
+    }
+    EXPECT_LE(end.peak_bytes - start_.live_bytes, budget.max_peak_bytes)
+        << "peak bytes over budget";
+    EXPECT_LE(end.live_bytes - start_.live_bytes, budget.max_leaked_bytes)
+        << "bytes still allocated at the end of the test";
+  }
+
+  void OnTestProgramEnd(const testing::UnitTest &) override {
+    if (print_report_ && alloc_stats::Total().allocations != 0) {
+      alloc_stats::Print(std::cout);
+    }
+  }
+
+ private:
+  AllocBudget default_;
+  bool print_report_;
+  std::uint64_t resets_;
+  AllocStats start_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_ALLOC_BUDGET_H_
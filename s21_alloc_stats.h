@@ -0,0 +1,308 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_ALLOC_STATS_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_ALLOC_STATS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Allocation counters of a container instance, a container type, or the
+// whole program.
+struct AllocStats {
+  std::uint64_t allocations = 0;
+  std::uint64_t deallocations = 0;
+  std::uint64_t bytes_allocated = 0;
+  std::uint64_t bytes_freed = 0;
+  // Signed: storage may be freed by another instance than the one that
+  // allocated it, e.g. after a List::splice.
+  std::int64_t live_bytes = 0;
+  std::int64_t peak_bytes = 0;
+};
+
+namespace alloc_stats {
+
+class Counters {
+ public:
+  void Allocated(std::size_t bytes) {
+    allocations_.fetch_add(1, std::memory_order_relaxed);
+    bytes_allocated_.fetch_add(bytes, std::memory_order_relaxed);
+    std::int64_t live =
+        live_bytes_.fetch_add(static_cast<std::int64_t>(bytes),
+                              std::memory_order_relaxed) +
+        static_cast<std::int64_t>(bytes);
+    std::int64_t peak = peak_bytes_.load(std::memory_order_relaxed);
+    while (peak < live && !peak_bytes_.compare_exchange_weak(
+                              peak, live, std::memory_order_relaxed)) {
+    }
+  }
+
+  void Freed(std::size_t bytes) {
+    deallocations_.fetch_add(1, std::memory_order_relaxed);
+    bytes_freed_.fetch_add(bytes, std::memory_order_relaxed);
+    live_bytes_.fetch_sub(static_cast<std::int64_t>(bytes),
+                          std::memory_order_relaxed);
+  }
+
+  // Frees are read before allocations: every free follows its allocation,
+  // so a snapshot taken while blocks are being freed does not show more
+  // frees than allocations.
+  AllocStats Snapshot() const {
+    AllocStats stats;
+    stats.deallocations = deallocations_.load(std::memory_order_relaxed);
+    stats.bytes_freed = bytes_freed_.load(std::memory_order_relaxed);
+    stats.allocations = allocations_.load(std::memory_order_relaxed);
+    stats.bytes_allocated = bytes_allocated_.load(std::memory_order_relaxed);
+    stats.live_bytes = live_bytes_.load(std::memory_order_relaxed);
+    stats.peak_bytes = peak_bytes_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+  // Starts the counts over from the blocks still live: they count as
+  // allocated, so freeing them later never makes frees exceed allocations.
+  // Live bytes stay, and become the new peak.
+  void Reset() {
+    std::uint64_t live = allocations_.load(std::memory_order_relaxed) -
+                         deallocations_.load(std::memory_order_relaxed);
+    allocations_.store(live, std::memory_order_relaxed);
+    deallocations_.store(0, std::memory_order_relaxed);
+    std::int64_t live_bytes = live_bytes_.load(std::memory_order_relaxed);
+    bytes_allocated_.store(
+        live_bytes > 0 ? static_cast<std::uint64_t>(live_bytes) : 0,
+        std::memory_order_relaxed);
+    bytes_freed_.store(0, std::memory_order_relaxed);
+    ResetPeak();
+  }
+
+  void ResetPeak() {
+    peak_bytes_.store(live_bytes_.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<std::uint64_t> allocations_{0};
+  std::atomic<std::uint64_t> deallocations_{0};
+  std::atomic<std::uint64_t> bytes_allocated_{0};
+  std::atomic<std::uint64_t> bytes_freed_{0};
+  std::atomic<std::int64_t> live_bytes_{0};
+  std::atomic<std::int64_t> peak_bytes_{0};
+};
+
+// Per-type counters by name. Entries are never removed, so a reference
+// stays valid for the whole program.
+class Registry {
+ public:
+  static Counters &Total() {
+    static Counters total;
+    return total;
+  }
+
+  static Counters &Type(const std::string &name) {
+    std::lock_guard<std::mutex> lock(Mutex());
+    return Types()[name];
+  }
+
+  static AllocStats Snapshot(const std::string &name) {
+    std::lock_guard<std::mutex> lock(Mutex());
+    auto it = Types().find(name);
+    return it == Types().end() ? AllocStats() : it->second.Snapshot();
+  }
+
+  template <class F>
+  static void ForEachType(F f) {
+    std::lock_guard<std::mutex> lock(Mutex());
+    for (auto &[name, counters] : Types()) f(name, counters);
+  }
+
+ private:
+  static std::mutex &Mutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  static std::map<std::string, Counters> &Types() {
+    static std::map<std::string, Counters> types;
+    return types;
+  }
+};
+
+// Names a container type in the allocation stats, and in the operation
+// stats of s21_stats.h.
+struct VectorTag {
+  static constexpr const char *kName = "s21::Vector";
+};
+
+struct ListTag {
+  static constexpr const char *kName = "s21::List";
+};
+
+struct DequeTag {
+  static constexpr const char *kName = "s21::Deque";
+};
+
+// BinaryTree is the storage of Set, and reports as one.
+struct SetTag {
+  static constexpr const char *kName = "s21::Set";
+};
+
+struct MapTag {
+  static constexpr const char *kName = "s21::Map";
+};
+
+struct MpmcQueueTag {
+  static constexpr const char *kName = "s21::MpmcQueue";
+};
+
+struct RingBufferTag {
+  static constexpr const char *kName = "s21::RingBuffer";
+};
+
+struct SpscQueueTag {
+  static constexpr const char *kName = "s21::SpscQueue";
+};
+
+struct UnrolledListTag {
+  static constexpr const char *kName = "s21::UnrolledList";
+};
+
+template <class Tag>
+Counters &TypeCounters() {
+  static Counters &counters = Registry::Type(Tag::kName);
+  return counters;
+}
+
+}  // namespace alloc_stats
+
+// std::allocator that counts into three places: the container instance it
+// belongs to, the container type named by Tag, and the program total.
+// Copies and rebinds share the instance counters, so they follow the
+// storage through moves and swaps; a copied container starts new ones.
+template <class T, class Tag>
+class TrackingAllocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::true_type;
+
+  template <class U>
+  struct rebind {
+    using other = TrackingAllocator<U, Tag>;
+  };
+
+  TrackingAllocator() : instance_(std::make_shared<alloc_stats::Counters>()) {}
+
+  template <class U>
+  TrackingAllocator(const TrackingAllocator<U, Tag> &other) noexcept
+      : instance_(other.instance_) {}
+
+  T *allocate(size_type n) {
+    T *ptr = std::allocator<T>().allocate(n);
+    instance_->Allocated(n * sizeof(T));
+    alloc_stats::TypeCounters<Tag>().Allocated(n * sizeof(T));
+    alloc_stats::Registry::Total().Allocated(n * sizeof(T));
+    return ptr;
+  }
+
+  void deallocate(T *ptr, size_type n) noexcept {
+    instance_->Freed(n * sizeof(T));
+    alloc_stats::TypeCounters<Tag>().Freed(n * sizeof(T));
+    alloc_stats::Registry::Total().Freed(n * sizeof(T));
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  TrackingAllocator select_on_container_copy_construction() const {
+    return TrackingAllocator();
+  }
+
+  AllocStats stats() const { return instance_->Snapshot(); }
+
+  template <class U>
+  bool operator==(const TrackingAllocator<U, Tag> &) const noexcept {
+    return true;
+  }
+
+  template <class U>
+  bool operator!=(const TrackingAllocator<U, Tag> &) const noexcept {
+    return false;
+  }
+
+ private:
+  template <class, class>
+  friend class TrackingAllocator;
+
+  std::shared_ptr<alloc_stats::Counters> instance_;
+};
+
+// The default allocator of the allocator-aware containers. Building with
+// S21_TRACK_ALLOCATIONS defined swaps in TrackingAllocator; the macro must
+// be the same in every translation unit of a program.
+#ifdef S21_TRACK_ALLOCATIONS
+template <class T, class Tag>
+using DefaultAllocator = TrackingAllocator<T, Tag>;
+#else
+template <class T, class Tag>
+using DefaultAllocator = std::allocator<T>;
+#endif
+
+namespace alloc_stats {
+
+inline AllocStats Total() { return Registry::Total().Snapshot(); }
+
+// All zeros for a type that never allocated.
+inline AllocStats ForType(const std::string &name) {
+  return Registry::Snapshot(name);
+}
+
+// Counters of one container built on a TrackingAllocator.
+template <class Container>
+AllocStats ForInstance(const Container &container) {
+  return container.get_allocator().stats();
+}
+
+inline std::vector<std::pair<std::string, AllocStats>> Report() {
+  std::vector<std::pair<std::string, AllocStats>> report;
+  Registry::ForEachType([&report](const std::string &name, const Counters &c) {
+    report.emplace_back(name, c.Snapshot());
+  });
+  return report;
+}
+
+inline void Print(std::ostream &out) {
+  auto line = [&out](const std::string &name, const AllocStats &stats) {
+    out << name << ": " << stats.allocations << " allocs, "
+        << stats.deallocations << " frees, " << stats.bytes_allocated
+        << " bytes, " << stats.live_bytes << " live, " << stats.peak_bytes
+        << " peak\n";
+  };
+  for (const auto &[name, stats] : Report()) line(name, stats);
+  line("total", Total());
+}
+
+// Number of Reset() calls so far.
+inline std::atomic<std::uint64_t> &Resets() {
+  static std::atomic<std::uint64_t> resets{0};
+  return resets;
+}
+
+// Restarts the type and total counts from what is live; instance counters
+// are left alone.
+inline void Reset() {
+  Registry::ForEachType([](const std::string &, Counters &c) { c.Reset(); });
+  Registry::Total().Reset();
+  Resets().fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace alloc_stats
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_ALLOC_STATS_H_
@@ -1,9 +1,17 @@
 #ifndef CPP2_S21_CONTAINERS_1_SRC_S21_ARRAY_H_
 #define CPP2_S21_CONTAINERS_1_SRC_S21_ARRAY_H_
 
-#include <iostream>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
 
 namespace s21 {
+
+// Fixed-size array and literal type: the size is the template argument
+// alone, so an Array<T, V> is exactly V elements, and everything except the
+// throwing paths can run at compile time.
 template <class T, const size_t V>
 class Array {
  public:
@@ -14,90 +22,165 @@ class Array {
   using const_Iterator = const T *;
   using size_type = size_t;
 
+  // Leaves trivial elements uninitialized, like a built-in array; Array{}
+  // zeroes them.
   Array() = default;
 
-  Array(std::initializer_list<value_type> const &items) : Array() {
-    if (items.size() > capacity_) {
+  constexpr Array(std::initializer_list<value_type> const &items) : array_() {
+    if (items.size() > V) {
       throw std::out_of_range("s21::Array::limit is exceeded");
     }
-    int i = 0;
-    for (auto element : items) {
-      array_[i++] = element;
-    }
-  };
-
-  Array(const Array &a) : Array() {
-    int i = 0;
-    for (auto element : a) {
-      array_[i] = element;
-      i = i + 1;
-    }
+    size_type i = 0;
+    for (const_reference element : items) array_[i++] = element;
   }
 
-  Array(Array &&a) : Array() { std::move(a.begin(), a.end(), this->array_); }
-
-  ~Array() = default;
-
-  Array &operator=(Array &a) {
-    std::swap(capacity_, a.capacity_);
-    std::swap(array_, a.array_);
-    return *this;
+  constexpr reference at(size_type pos) {
+    if (pos >= V) throw std::out_of_range("s21::Array::limit is exceeded");
+    return array_[pos];
   }
 
-  Array &operator=(Array &&a) {
-    capacity_ = 0;
-    fill(0);
-    std::swap(capacity_, a.capacity_);
-    std::swap(array_, a.array_);
-    return *this;
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= V) throw std::out_of_range("s21::Array::limit is exceeded");
+    return array_[pos];
   }
 
-  reference at(size_type pos) {
-    if (pos >= capacity_) {
-      throw std::out_of_range("s21::Array::limit is exceeded");
-    }
+  constexpr reference operator[](size_type pos) { return array_[pos]; }
+
+  constexpr const_reference operator[](size_type pos) const {
     return array_[pos];
   }
 
-  reference operator[](size_type pos) { return *(array_ + pos); }
+  constexpr reference front() { return array_[0]; }
 
-  const_reference front() const { return *(array_); }
+  constexpr const_reference front() const { return array_[0]; }
 
-  const_reference back() const { return array_[capacity_ - 1]; }
+  constexpr reference back() { return array_[V - 1]; }
 
-  Iterator data() noexcept { return array_; }
+  constexpr const_reference back() const { return array_[V - 1]; }
 
-  Iterator begin() noexcept { return array_; }
+  constexpr Iterator data() noexcept { return array_; }
 
-  Iterator end() noexcept { return array_ + capacity_; }
+  constexpr const_Iterator data() const noexcept { return array_; }
 
-  const_Iterator begin() const { return array_; }
+  constexpr Iterator begin() noexcept { return array_; }
 
-  const_Iterator end() const { return array_ + capacity_; }
+  constexpr Iterator end() noexcept { return array_ + V; }
 
-  bool empty() {
-    if (capacity_ == 0) return true;
-    return false;
-  }
+  constexpr const_Iterator begin() const noexcept { return array_; }
 
-  size_type size() { return capacity_; }
+  constexpr const_Iterator end() const noexcept { return array_ + V; }
 
-  size_type max_size() { return capacity_; }
+  constexpr const_Iterator cbegin() const noexcept { return array_; }
 
-  void swap(Array &other) {
-    std::swap(array_, other.array_);
-    std::swap(capacity_, other.capacity_);
+  constexpr const_Iterator cend() const noexcept { return array_ + V; }
+
+  constexpr bool empty() const noexcept { return V == 0; }
+
+  constexpr size_type size() const noexcept { return V; }
+
+  constexpr size_type max_size() const noexcept { return V; }
+
+  constexpr void swap(Array &other) {
+    for (size_type i = 0; i < V; ++i) {
+      value_type tmp = std::move(array_[i]);
+      array_[i] = std::move(other.array_[i]);
+      other.array_[i] = std::move(tmp);
+    }
   }
 
-  void fill(const_reference value) {
-    for (size_t i = 0; i < capacity_; i++) array_[i] = value;
+  constexpr void fill(const_reference value) {
+    for (size_type i = 0; i < V; ++i) array_[i] = value;
   }
 
  private:
-  value_type array_[V];
-  size_type capacity_ = V;
+  // One spare element keeps Array<T, 0> a valid type, as with std::array.
+  value_type array_[V == 0 ? 1 : V];
 };
 
+template <class T, size_t V>
+constexpr bool operator==(const Array<T, V> &a, const Array<T, V> &b) {
+  for (size_t i = 0; i < V; ++i) {
+    if (!(a[i] == b[i])) return false;
+  }
+  return true;
+}
+
+template <class T, size_t V>
+constexpr bool operator!=(const Array<T, V> &a, const Array<T, V> &b) {
+  return !(a == b);
+}
+
+template <class T, size_t V>
+constexpr bool operator<(const Array<T, V> &a, const Array<T, V> &b) {
+  for (size_t i = 0; i < V; ++i) {
+    if (a[i] < b[i]) return true;
+    if (b[i] < a[i]) return false;
+  }
+  return false;
+}
+
+template <class T, size_t V>
+constexpr bool operator>(const Array<T, V> &a, const Array<T, V> &b) {
+  return b < a;
+}
+
+template <class T, size_t V>
+constexpr bool operator<=(const Array<T, V> &a, const Array<T, V> &b) {
+  return !(b < a);
+}
+
+template <class T, size_t V>
+constexpr bool operator>=(const Array<T, V> &a, const Array<T, V> &b) {
+  return !(a < b);
+}
+
+// Heapsort: O(n log n) without recursion or extra memory, which keeps it
+// within the compiler's constexpr step limit for tables of many thousands of
+// elements. Not stable.
+template <class T, size_t V, class Compare = std::less<T>>
+constexpr void sort(Array<T, V> &a, Compare comp = Compare()) {
+  auto sift_down = [&a, &comp](size_t index, size_t n) {
+    for (size_t child = 2 * index + 1; child < n; child = 2 * index + 1) {
+      if (child + 1 < n && comp(a[child], a[child + 1])) ++child;
+      if (!comp(a[index], a[child])) break;
+      T tmp = std::move(a[index]);
+      a[index] = std::move(a[child]);
+      a[child] = std::move(tmp);
+      index = child;
+    }
+  };
+  for (size_t i = V / 2; i-- > 0;) sift_down(i, V);
+  for (size_t n = V; n > 1; --n) {
+    T tmp = std::move(a[0]);
+    a[0] = std::move(a[n - 1]);
+    a[n - 1] = std::move(tmp);
+    sift_down(0, n - 1);
+  }
+}
+
+// a must be sorted by comp.
+template <class T, size_t V, class Compare = std::less<T>>
+constexpr bool binary_search(const Array<T, V> &a, const T &value,
+                             Compare comp = Compare()) {
+  size_t first = 0, count = V;
+  while (count > 0) {
+    size_t half = count / 2;
+    if (comp(a[first + half], value)) {
+      first += half + 1;
+      count -= half + 1;
+    } else {
+      count = half;
+    }
+  }
+  return first < V && !comp(value, a[first]);
+}
+
+template <class T, size_t V, class U, class BinaryOp = std::plus<>>
+constexpr U accumulate(const Array<T, V> &a, U init, BinaryOp op = BinaryOp()) {
+  for (size_t i = 0; i < V; ++i) init = op(std::move(init), a[i]);
+  return init;
+}
+
 }  // namespace s21
 
 #endif  // CPP2_S21_CONTAINERS_1_SRC_S21_ARRAY_H_
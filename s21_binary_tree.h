@@ -3,9 +3,148 @@
 
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <utility>
+
+#include "s21_alloc_stats.h"
+#include "s21_stats.h"
 
 namespace s21 {
-template <class K, class Compare = std::less<K>>
+// Link-level tree algorithms shared by BinaryTree and IntrusiveSet. Node is
+// any type with left/right/parent pointers and an is_fake flag; the fake node
+// hangs off the right of the maximum and serves as end().
+template <class Node>
+struct TreeLinks {
+  static Node *Real(Node *node) {
+    return node != nullptr && !node->is_fake ? node : nullptr;
+  }
+
+  static Node *MinNode(Node *node) {
+    while (!node->is_fake && node->left) {
+      node = node->left;
+    }
+    return node;
+  }
+
+  static Node *MaxNode(Node *node) {
+    while (node->right && !node->right->is_fake) {
+      node = node->right;
+    }
+    return node;
+  }
+
+  static Node *Next(Node *node) {
+    if (node->right) {
+      node = node->right;
+      while (!node->is_fake && node->left) {
+        node = node->left;
+      }
+    } else {
+      Node *buff = node;
+      node = node->parent;
+      while (buff == node->right && !node->is_fake) {
+        buff = node;
+        node = node->parent;
+      }
+    }
+    return node;
+  }
+
+  static Node *Prev(Node *node) {
+    if (node->is_fake) return node->parent;
+    if (node->left) {
+      node = node->left;
+      while (Real(node->right)) {
+        node = node->right;
+      }
+    } else {
+      Node *buff = node;
+      node = node->parent;
+      while (node && buff == node->left) {
+        buff = node;
+        node = node->parent;
+      }
+    }
+    return node;
+  }
+
+  // Links node under root; returns the equal node instead when there is one.
+  // The links of node are only written once it is linked, so a node that is
+  // already in the tree comes back as its own equal, untouched.
+  template <class Less>
+  static Node *Link(Node *&root, Node *node, Less less) {
+    if (root == nullptr || root->is_fake) {
+      node->left = node->right = nullptr;
+      node->parent = nullptr;
+      root = node;
+      return nullptr;
+    }
+    Node *tmp = root;
+    while (true) {
+      if (less(node, tmp)) {
+        if (tmp->left == nullptr) {
+          tmp->left = node;
+          break;
+        }
+        tmp = tmp->left;
+      } else if (less(tmp, node)) {
+        if (Real(tmp->right) == nullptr) {
+          tmp->right = node;
+          break;
+        }
+        tmp = tmp->right;
+      } else {
+        return tmp;
+      }
+    }
+    node->left = node->right = nullptr;
+    node->parent = tmp;
+    return nullptr;
+  }
+
+  // Unlinks node, treating the fake node as absent; root becomes nullptr
+  // when node was the last one. The links of node itself are left as they
+  // were. The caller reattaches the fake node.
+  static void Erase(Node *&root, Node *node) {
+    Node *left = node->left;
+    Node *right = Real(node->right);
+    Node *replacement = left ? left : right;
+    if (left && right) {
+      Node *successor = MinNode(right);
+      if (successor != right) {
+        Node *successor_right = Real(successor->right);
+        successor->parent->left = successor_right;
+        if (successor_right) successor_right->parent = successor->parent;
+        successor->right = right;
+        right->parent = successor;
+      }
+      successor->left = left;
+      left->parent = successor;
+      replacement = successor;
+    }
+    Node *parent = node->parent;
+    if (parent == nullptr) {
+      root = replacement;
+    } else if (parent->left == node) {
+      parent->left = replacement;
+    } else {
+      parent->right = replacement;
+    }
+    if (replacement) replacement->parent = parent;
+  }
+
+  static void AttachFake(Node *root, Node *fake) {
+    Node *max = MaxNode(root);
+    max->right = fake;
+    fake->parent = max;
+  }
+};
+
+// StatsTag names the container type the tree's operations report to when
+// built with S21_STATS.
+template <class K, class Compare = std::less<K>,
+          class Allocator = DefaultAllocator<K, alloc_stats::SetTag>,
+          class StatsTag = alloc_stats::SetTag>
 class BinaryTree {
  public:
   using key_type = K;
@@ -13,11 +152,14 @@ class BinaryTree {
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = size_t;
+  using allocator_type = Allocator;
+
+  struct BTNode;
 
  public:
   class Iterator {
    public:
-    using tree_node = typename BinaryTree<K>::BTNode;
+    using tree_node = BTNode;
 
     Iterator() : ptr(new BTNode()) {}
     Iterator(tree_node *btNode) : ptr(btNode) {}
@@ -61,42 +203,16 @@ class BinaryTree {
    protected:
     tree_node *ptr;
 
-    void IteratorIncremented() {
-      if (ptr->right) {
-        ptr = ptr->right;
-        while (!ptr->is_fake && ptr->left) {
-          ptr = ptr->left;
-        }
-      } else {
-        BTNode *buff = ptr;
-        ptr = ptr->parent;
-        while (buff == ptr->right && !ptr->is_fake) {
-          buff = ptr;
-          ptr = ptr->parent;
-        }
-      }
-    }
-    void IteratorDecremented() {
-      if (ptr->left) {
-        ptr = ptr->left;
-        while (ptr->right) {
-          ptr = ptr->right;
-        }
-      } else {
-        BTNode *buff = ptr;
-        ptr = ptr->parent;
-        while (buff == ptr->left) {
-          buff = ptr;
-          ptr = ptr->parent;
-        }
-      }
-    }
+    void IteratorIncremented() { ptr = TreeLinks<tree_node>::Next(ptr); }
+
+    void IteratorDecremented() { ptr = TreeLinks<tree_node>::Prev(ptr); }
+
     friend class BinaryTree;
   };
 
   class ConstIterator : public Iterator {
    public:
-    using tree_node = typename BinaryTree<K>::BTNode;
+    using tree_node = BTNode;
 
     ConstIterator() : Iterator() {}
     explicit ConstIterator(const tree_node *btNode) : Iterator(btNode) {}
@@ -113,14 +229,18 @@ class BinaryTree {
 
   size_type size() { return bt_size; }
 
+  // The tree constructs and destroys val of its own nodes through the
+  // allocator, so that values taking one (e.g. pmr containers) get it too.
   struct BTNode {
-    value_type val;
+    union {
+      value_type val;
+    };
     struct BTNode *left;
     struct BTNode *right;
     struct BTNode *parent;
     bool is_fake = false;
 
-    BTNode() : left(nullptr), right(nullptr), parent(nullptr) {}
+    BTNode() : val(), left(nullptr), right(nullptr), parent(nullptr) {}
 
     explicit BTNode(value_type x)
         : val(x), left(nullptr), right(nullptr), parent(nullptr) {}
@@ -130,9 +250,21 @@ class BinaryTree {
           left(btNode.left),
           right(btNode.right),
           parent(btNode.parent) {}
+
+    ~BTNode() {}
+
+   private:
+    friend class BinaryTree;
+
+    struct Unset {};
+
+    explicit BTNode(Unset) : left(nullptr), right(nullptr), parent(nullptr) {}
   };
 
-  BinaryTree() : root(nullptr), fake_node(new BTNode()), bt_size(0) {
+  BinaryTree() : BinaryTree(allocator_type()) {}
+
+  explicit BinaryTree(const allocator_type &alloc)
+      : alloc_(alloc), root(nullptr), fake_node(CreateNode()), bt_size(0) {
     MakeRootFake();
   }
 
@@ -142,75 +274,90 @@ class BinaryTree {
     }
   }
 
-  BinaryTree(const BinaryTree &other) : BinaryTree() {
-    root = CopyTree(other.root);
+  BinaryTree(const BinaryTree &other)
+      : BinaryTree(other,
+                   node_traits::select_on_container_copy_construction(
+                       other.alloc_)) {}
+
+  BinaryTree(const BinaryTree &other, const allocator_type &alloc)
+      : BinaryTree(alloc) {
+    if (other.root->is_fake) return;
+    root = CopyTree(other.root, nullptr);
     bt_size = other.bt_size;
+    InsertFakeNode(root);
   }
 
-  BinaryTree(BinaryTree &&binaryTree) noexcept : BinaryTree() {
+  BinaryTree(BinaryTree &&binaryTree) noexcept
+      : BinaryTree(binaryTree.get_allocator()) {
     swap(binaryTree);
   }
 
+  // Takes the nodes only when alloc can free them; otherwise copies.
+  BinaryTree(BinaryTree &&binaryTree, const allocator_type &alloc)
+      : BinaryTree(alloc) {
+    if (alloc_ == binaryTree.alloc_) {
+      swap(binaryTree);
+    } else if (!binaryTree.root->is_fake) {
+      root = CopyTree(binaryTree.root, nullptr);
+      bt_size = binaryTree.bt_size;
+      InsertFakeNode(root);
+    }
+  }
+
   ~BinaryTree() {
     if (!root->is_fake) RemoveNode(root);
-    delete fake_node;
+    DestroyNode(fake_node);
     root = nullptr;
     fake_node = nullptr;
     bt_size = 0;
   }
 
-  BinaryTree &operator=(BinaryTree &&binaryTree) noexcept {
-    swap(binaryTree);
+  BinaryTree &operator=(BinaryTree &&binaryTree) noexcept(
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value) {
+    if (node_traits::propagate_on_container_move_assignment::value ||
+        alloc_ == binaryTree.alloc_) {
+      swap(binaryTree);
+    } else {
+      BinaryTree tmp(std::move(binaryTree), get_allocator());
+      swap(tmp);
+    }
     return *this;
   }
 
   std::pair<iterator, bool> insert(const value_type &value) {
-    int insertion_successful = false;
-    if (FindNode(value) != nullptr) {
-      return std::make_pair(end(), insertion_successful);
+    stats::Probe<StatsTag> probe(stats::Op::kInsert);
+    auto *newNode = CreateNode(value);
+    auto less = [&probe](const BTNode *a, const BTNode *b) {
+      probe.Compare();
+      return NodeLess(a, b);
+    };
+    if (TreeLinks<BTNode>::Link(root, newNode, less) != nullptr) {
+      DestroyNode(newNode);
+      return std::make_pair(end(), false);
     }
-
-    auto *newNode = new BTNode(value);
-    if (root->is_fake) {
-      root = newNode;
-      insertion_successful = true;
-    } else {
-      BTNode *tmp = root;
-      BTNode *result = tmp;
-      while (!insertion_successful && tmp) {
-        if (value < tmp->val) {
-          if (tmp->left) {
-            tmp = tmp->left;
-          } else {
-            tmp->left = newNode;
-            newNode->parent = tmp;
-            insertion_successful = true;
-          }
-        } else if (tmp->val < value) {
-          if (tmp->right && !tmp->right->is_fake) {
-            tmp = tmp->right;
-          } else {
-            tmp->right = newNode;
-            newNode->parent = tmp;
-            insertion_successful = true;
-          }
-        }
+    if constexpr (stats::kEnabled) {
+      for (BTNode *node = newNode->parent; node; node = node->parent) {
+        probe.Visit();
       }
-      root = result;
-    }
-    if (insertion_successful) {
-      bt_size++;
-      InsertFakeNode(root);
     }
+    bt_size++;
+    InsertFakeNode(root);
     return std::make_pair(iterator(newNode), true);
   }
 
   BTNode *FindNode(value_type value) {
+    stats::Probe<StatsTag> probe(stats::Op::kFind);
     BTNode *tmp = root;
     while (tmp && !tmp->is_fake) {
+      probe.Visit();
+      probe.Compare();
       if (value < tmp->val) {
         tmp = tmp->left;
-      } else if (tmp->val < value) {
+        continue;
+      }
+      probe.Compare();
+      if (tmp->val < value) {
         tmp = tmp->right;
       } else
         return tmp;
@@ -222,8 +369,13 @@ class BinaryTree {
     std::swap(root, other.root);
     std::swap(fake_node, other.fake_node);
     std::swap(bt_size, other.bt_size);
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
   }
 
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
   void PrintTreeMain() { PrintTreeSupportive(root, "root", 0); }
 
   void PrintTreeSupportive(BTNode *btNode, const char *dir, int level) {
@@ -249,7 +401,7 @@ class BinaryTree {
   }
 
   void merge(BinaryTree &other) {
-    BinaryTree<K, Compare> mergedTree;
+    BinaryTree mergedTree(get_allocator());
 
     for (const auto &value : *this) {
       mergedTree.insert(value);
@@ -263,6 +415,18 @@ class BinaryTree {
     other.clear();
   }
 
+  // Builds a balanced tree in O(n) from a strictly ascending random-access
+  // range, replacing the current contents.
+  template <class RandomIt>
+  void assign_sorted(RandomIt first, RandomIt last) {
+    clear();
+    size_type count = static_cast<size_type>(last - first);
+    if (count == 0) return;
+    root = BuildSorted(first, count, nullptr);
+    bt_size = count;
+    InsertFakeNode(root);
+  }
+
   iterator find(const value_type &value) {
     BTNode *tmp = FindNode(value);
     return iterator(tmp);
@@ -275,85 +439,75 @@ class BinaryTree {
       return;
     }
 
+    stats::Probe<StatsTag> probe(stats::Op::kErase);
     BTNode *node = pos.ptr;
-    BTNode *parent = node->parent;
-
-    if (node->left == nullptr && node->right == nullptr) {
-      if (parent->left == node) {
-        parent->left = nullptr;
-      } else {
-        parent->right = nullptr;
-      }
-    } else if (node->left == nullptr) {
-      if (parent == nullptr) {
-        root = node->right;
-        root->parent = nullptr;
-      } else if (parent->left == node) {
-        parent->left = node->right;
-        node->right->parent = parent;
-      } else {
-        parent->right = node->right;
-        node->right->parent = parent;
-      }
-    } else if (node->right == nullptr) {
-      if (parent == nullptr) {
-        root = node->left;
-        root->parent = nullptr;
-      } else if (parent->left == node) {
-        parent->left = node->left;
-        node->left->parent = parent;
-      } else {
-        parent->right = node->left;
-        node->left->parent = parent;
-      }
-    } else {
-      BTNode *successor = MinNode(node->right);
-
-      if (successor->parent != node) {
-        BTNode *successorParent = successor->parent;
-        successorParent->left = successor->right;
-
-        if (successor->right != nullptr) {
-          successor->right->parent = successorParent;
-        }
-
-        successor->right = node->right;
-        successor->right->parent = successor;
-      }
-
-      if (parent == nullptr) {
-        root = successor;
-        root->parent = nullptr;
-      } else if (parent->left == node) {
-        parent->left = successor;
-        successor->parent = parent;
-      } else {
-        parent->right = successor;
-        successor->parent = parent;
-      }
-
-      successor->left = node->left;
-      successor->left->parent = successor;
-    }
-
-    delete node;
+    TreeLinks<BTNode>::Erase(root, node);
+    DestroyNode(node);
     --bt_size;
+    if (root)
+      InsertFakeNode(root);
+    else
+      MakeRootFake();
   }
 
  private:
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<BTNode>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  using value_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<value_type>;
+  using value_traits = std::allocator_traits<value_allocator>;
+
+  // Declared first: the constructors allocate the fake node with it.
+  node_allocator alloc_;
   BTNode *root;
   BTNode *fake_node;
   size_type bt_size{};
 
-  BTNode *CopyTree(const BTNode *btNode) {
-    if (btNode == nullptr) return nullptr;
-    auto *newNode = new BTNode(btNode->val);
-    newNode->parent = btNode->parent;  // !!!
-    if (btNode->left) newNode->left = CopyTree(btNode->left);
-    if (btNode->right && !btNode->right->is_fake) {
-      newNode->right = CopyTree(btNode->right);
-    } else if (btNode->right && btNode->right->is_fake)
-      InsertFakeNode(newNode);
+  template <class... Args>
+  BTNode *CreateNode(Args &&...args) {
+    BTNode *node = node_traits::allocate(alloc_, 1);
+    ::new (static_cast<void *>(node)) BTNode(typename BTNode::Unset());
+    try {
+      value_allocator values(alloc_);
+      value_traits::construct(values, std::addressof(node->val),
+                              std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void DestroyNode(BTNode *node) {
+    value_allocator values(alloc_);
+    value_traits::destroy(values, std::addressof(node->val));
+    node->~BTNode();
+    node_traits::deallocate(alloc_, node, 1);
+  }
+
+  static bool NodeLess(const BTNode *a, const BTNode *b) {
+    return a->val < b->val;
+  }
+
+  BTNode *CopyTree(const BTNode *btNode, BTNode *parent) {
+    if (btNode == nullptr || btNode->is_fake) return nullptr;
+    auto *newNode = CreateNode(btNode->val);
+    newNode->parent = parent;
+    newNode->left = CopyTree(btNode->left, newNode);
+    newNode->right = CopyTree(btNode->right, newNode);
+    return newNode;
+  }
+
+  template <class RandomIt>
+  BTNode *BuildSorted(RandomIt first, size_type count, BTNode *parent) {
+    if (count == 0) return nullptr;
+    size_type middle = count / 2;
+    auto *newNode = CreateNode(first[middle]);
+    newNode->parent = parent;
+    newNode->left = BuildSorted(first, middle, newNode);
+    newNode->right =
+        BuildSorted(first + middle + 1, count - middle - 1, newNode);
     return newNode;
   }
 
@@ -367,9 +521,7 @@ class BinaryTree {
   }
 
   void InsertFakeNode(BTNode *btNode) {
-    BTNode *tmp = MaxNode(btNode);
-    tmp->right = fake_node;
-    fake_node->parent = tmp;
+    TreeLinks<BTNode>::AttachFake(btNode, fake_node);
   }
 
   void RemoveNode(BTNode *btNode) {
@@ -381,22 +533,12 @@ class BinaryTree {
       RemoveNode(btNode->right);
       btNode->right = nullptr;
     }
-    delete btNode;
+    DestroyNode(btNode);
     btNode = nullptr;
   }
 
   BTNode *MinNode(BTNode *btNode) {
-    while (!btNode->is_fake && btNode->left) {
-      btNode = btNode->left;
-    }
-    return btNode;
-  }
-
-  BTNode *MaxNode(BTNode *btNode) {
-    while (btNode->right && !btNode->right->is_fake) {
-      btNode = btNode->right;
-    }
-    return btNode;
+    return TreeLinks<BTNode>::MinNode(btNode);
   }
 };
 
@@ -0,0 +1,166 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_CHANNEL_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_CHANNEL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+#include "s21_deque.h"
+#include "s21_queue.h"
+
+namespace s21 {
+
+// Blocking FIFO between pipeline stages: a Queue behind a mutex, with
+// consumers parked on a condition variable instead of polling. A non-zero
+// capacity bounds the channel, and producers then block while it is full.
+//
+// close() wakes everyone. Pushes then fail, and pops keep returning the
+// remaining elements until the channel is drained, after which they return
+// false (or 0 for pop_all) instead of blocking.
+template <class T, class Container = Deque<T>>
+class Channel {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  // A capacity of 0 means unbounded.
+  explicit Channel(size_type capacity = 0) : capacity_(capacity) {}
+
+  Channel(const Channel &) = delete;
+
+  Channel &operator=(const Channel &) = delete;
+
+  size_type capacity() const { return capacity_; }
+
+  size_type size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+  }
+
+  bool empty() { return size() == 0; }
+
+  bool closed() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+
+  void close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    not_empty_.notify_all();
+    not_full_.notify_all();
+  }
+
+  // Blocks while the channel is full; returns false if it is closed.
+  bool push(const_reference value) { return Push(value, true); }
+
+  bool push(value_type &&value) { return Push(std::move(value), true); }
+
+  // Returns false if the channel is full or closed.
+  bool try_push(const_reference value) { return Push(value, false); }
+
+  bool try_push(value_type &&value) { return Push(std::move(value), false); }
+
+  // Blocks until an element arrives; returns false once the channel is
+  // closed and drained.
+  bool pop(reference out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    Wait(not_empty_, waiting_pop_, lock, [this] { return Readable(); });
+    return Take(out);
+  }
+
+  bool try_pop(reference out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return Take(out);
+  }
+
+  // Like pop, but gives up after timeout.
+  template <class Rep, class Period>
+  bool pop_for(reference out,
+               const std::chrono::duration<Rep, Period> &timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    ++waiting_pop_;
+    not_empty_.wait_until(lock, deadline, [this] { return Readable(); });
+    --waiting_pop_;
+    return Take(out);
+  }
+
+  // Blocks until at least one element is available, then moves up to limit
+  // of them to out under a single lock. Returns how many were moved, 0 only
+  // once the channel is closed and drained.
+  template <class OutputIt>
+  size_type pop_all(OutputIt out,
+                    size_type limit = std::numeric_limits<size_type>::max()) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    Wait(not_empty_, waiting_pop_, lock, [this] { return Readable(); });
+    size_type taken = 0;
+    for (; taken < limit && !queue_.empty(); ++taken, ++out) {
+      *out = std::move(queue_.front());
+      queue_.pop();
+    }
+    if (taken > 1) {
+      if (waiting_push_ != 0) not_full_.notify_all();
+    } else if (taken == 1 && waiting_push_ != 0) {
+      not_full_.notify_one();
+    }
+    return taken;
+  }
+
+ private:
+  Queue<T, Container> queue_;
+  size_type capacity_;
+  bool closed_ = false;
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  // Threads parked on each condition, so the other side can skip notify
+  // when nobody listens.
+  size_type waiting_push_ = 0;
+  size_type waiting_pop_ = 0;
+
+  bool Readable() { return !queue_.empty() || closed_; }
+
+  bool Writable() {
+    return closed_ || capacity_ == 0 || queue_.size() < capacity_;
+  }
+
+  template <class Ready>
+  static void Wait(std::condition_variable &cv, size_type &waiting,
+                   std::unique_lock<std::mutex> &lock, Ready ready) {
+    if (ready()) return;
+    ++waiting;
+    cv.wait(lock, ready);
+    --waiting;
+  }
+
+  template <class U>
+  bool Push(U &&value, bool block) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (block) {
+      Wait(not_full_, waiting_push_, lock, [this] { return Writable(); });
+    }
+    if (closed_ || !Writable()) return false;
+    queue_.emplace(std::forward<U>(value));
+    if (waiting_pop_ != 0) not_empty_.notify_one();
+    return true;
+  }
+
+  // Called with the lock held.
+  bool Take(reference out) {
+    if (queue_.empty()) return false;
+    out = std::move(queue_.front());
+    queue_.pop();
+    if (waiting_push_ != 0) not_full_.notify_one();
+    return true;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_CHANNEL_H_
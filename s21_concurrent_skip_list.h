@@ -0,0 +1,482 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_CONCURRENT_SKIP_LIST_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_CONCURRENT_SKIP_LIST_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+
+// Lock-free skip list shared by ConcurrentSkipListSet and
+// ConcurrentSkipListMap. Every level is a Harris list: the low bit of a next
+// pointer marks its node as deleted, and searches unlink marked nodes as they
+// pass. Lookups and iteration only read; insert and erase publish with CAS.
+// Lookups and insert are lock-free. Erase is too, except that erasing an
+// element whose insert is still linking its upper levels waits for that
+// insert to finish. Erased nodes are retired through Epoch, so iterators stay
+// valid while their guard pins the epoch, even if the element is erased
+// meanwhile.
+template <class Key, class Value, class KeyOf, class Compare>
+class ConcurrentSkipList {
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  static constexpr int kMaxLevel = 24;
+
+ private:
+  struct alignas(std::atomic<std::uintptr_t>) Node {
+    int height;
+    std::atomic<bool> fully_linked;
+    value_type value;
+  };
+
+ public:
+  // Carries its own Epoch::Guard, so it must be used on the thread that
+  // created it. A node erased under the iterator can still be read, and
+  // advancing from it continues with its successor at the time of removal.
+  class ConcurrentSkipListIterator {
+    friend ConcurrentSkipList;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ConcurrentSkipList::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type *;
+    using reference = value_type &;
+
+    ConcurrentSkipListIterator() = default;
+    explicit ConcurrentSkipListIterator(Node *ptr) : ptr(ptr) {}
+
+    reference operator*() const { return ptr->value; }
+
+    value_type *operator->() const { return &ptr->value; }
+
+    ConcurrentSkipListIterator &operator++() {
+      ptr = NextAlive(Unmark(Next(ptr)[0].load(std::memory_order_acquire)), 0);
+      return *this;
+    }
+
+    ConcurrentSkipListIterator operator++(int) {
+      ConcurrentSkipListIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const ConcurrentSkipListIterator &other) const {
+      return ptr == other.ptr;
+    }
+
+    bool operator!=(const ConcurrentSkipListIterator &other) const {
+      return ptr != other.ptr;
+    }
+
+   private:
+    Epoch::Guard guard;
+    Node *ptr = nullptr;
+  };
+
+  using iterator = ConcurrentSkipListIterator;
+
+  ConcurrentSkipList() : ConcurrentSkipList(Compare()) {}
+
+  explicit ConcurrentSkipList(const Compare &comp)
+      : head_(AllocateNode(kMaxLevel)), size_(0), comp_(comp) {
+    for (int level = 0; level < kMaxLevel; ++level) {
+      new (Next(head_) + level) std::atomic<std::uintptr_t>(0);
+    }
+  }
+
+  ConcurrentSkipList(const ConcurrentSkipList &) = delete;
+
+  ConcurrentSkipList &operator=(const ConcurrentSkipList &) = delete;
+
+  // Not thread-safe: no other thread may use the list while it is destroyed.
+  ~ConcurrentSkipList() {
+    Node *node = Unmark(Next(head_)[0].load(std::memory_order_acquire));
+    while (node != nullptr) {
+      Node *next = Unmark(Next(node)[0].load(std::memory_order_relaxed));
+      DestroyNode(node);
+      node = next;
+    }
+    ::operator delete(head_);
+  }
+
+  iterator begin() const {
+    Epoch::Guard guard;
+    return iterator(
+        NextAlive(Unmark(Next(head_)[0].load(std::memory_order_acquire)), 0));
+  }
+
+  iterator end() const { return iterator(nullptr); }
+
+  bool empty() const { return begin() == end(); }
+
+  // Exact when no insert or erase is in flight.
+  size_type size() const { return size_.load(std::memory_order_relaxed); }
+
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() /
+           (sizeof(Node) + sizeof(std::atomic<std::uintptr_t>));
+  }
+
+  // Erases the elements one by one, so it may run concurrently with other
+  // operations; elements inserted meanwhile may survive.
+  void clear() {
+    for (iterator it = begin(); it != end(); ++it) erase(KeyOf()(*it));
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    Epoch::Guard guard;
+    const key_type &key = KeyOf()(value);
+    Node *preds[kMaxLevel];
+    Node *succs[kMaxLevel];
+    Node *node = nullptr;
+    int height = RandomHeight();
+    for (;;) {
+      if (Find(key, preds, succs)) {
+        if (node != nullptr) DestroyNode(node);
+        return std::make_pair(iterator(succs[0]), false);
+      }
+      if (node == nullptr) node = CreateNode(value, height);
+      for (int level = 0; level < height; ++level) {
+        Next(node)[level].store(Raw(succs[level]), std::memory_order_relaxed);
+      }
+      std::uintptr_t expected = Raw(succs[0]);
+      if (Next(preds[0])[0].compare_exchange_strong(
+              expected, Raw(node), std::memory_order_release,
+              std::memory_order_relaxed)) {
+        break;
+      }
+    }
+    // The node is in the set from here on; the upper levels only speed up
+    // searches. Erase waits for fully_linked, so nothing marks the node
+    // while its levels are still being published.
+    for (int level = 1; level < height; ++level) {
+      for (;;) {
+        // A successor marked since the search must not end up behind node:
+        // erase could no longer unlink it from there.
+        Node *succ = succs[level];
+        if (succ == nullptr ||
+            !IsMarked(Next(succ)[level].load(std::memory_order_acquire))) {
+          std::uintptr_t expected = Raw(succ);
+          if (Next(preds[level])[level].compare_exchange_strong(
+                  expected, Raw(node), std::memory_order_release,
+                  std::memory_order_relaxed)) {
+            break;
+          }
+        }
+        Find(key, preds, succs);
+        Next(node)[level].store(Raw(succs[level]), std::memory_order_relaxed);
+      }
+    }
+    node->fully_linked.store(true, std::memory_order_release);
+    size_.fetch_add(1, std::memory_order_relaxed);
+    return std::make_pair(iterator(node), true);
+  }
+
+  // Returns the number of elements removed, 0 or 1.
+  size_type erase(const key_type &key) {
+    Epoch::Guard guard;
+    Node *preds[kMaxLevel];
+    Node *succs[kMaxLevel];
+    if (!Find(key, preds, succs)) return 0;
+    Node *victim = succs[0];
+    while (!victim->fully_linked.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    for (int level = victim->height - 1; level > 0; --level) {
+      std::uintptr_t next = Next(victim)[level].load(std::memory_order_relaxed);
+      while (!IsMarked(next) &&
+             !Next(victim)[level].compare_exchange_weak(
+                 next, next | 1, std::memory_order_acq_rel)) {
+      }
+    }
+    // Whoever marks level 0 owns the removal.
+    std::uintptr_t next = Next(victim)[0].load(std::memory_order_relaxed);
+    for (;;) {
+      if (IsMarked(next)) return 0;
+      if (Next(victim)[0].compare_exchange_weak(next, next | 1,
+                                                std::memory_order_acq_rel)) {
+        break;
+      }
+    }
+    Unlink(victim);
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    Epoch::Retire(victim, &DestroyErased);
+    return 1;
+  }
+
+  void erase(iterator pos) { erase(KeyOf()(*pos)); }
+
+  iterator find(const key_type &key) const {
+    iterator it = lower_bound(key);
+    if (it != end() && comp_(key, KeyOf()(*it))) return end();
+    return it;
+  }
+
+  bool contains(const key_type &key) const { return find(key) != end(); }
+
+  // First element not ordered before key; iterate from it for range scans.
+  iterator lower_bound(const key_type &key) const {
+    Epoch::Guard guard;
+    Node *pred = head_;
+    Node *curr = nullptr;
+    for (int level = kMaxLevel - 1; level >= 0; --level) {
+      curr = NextAlive(
+          Unmark(Next(pred)[level].load(std::memory_order_acquire)), level);
+      while (curr != nullptr && comp_(KeyOf()(curr->value), key)) {
+        pred = curr;
+        curr = NextAlive(
+            Unmark(Next(curr)[level].load(std::memory_order_acquire)), level);
+      }
+    }
+    return iterator(curr);
+  }
+
+  // First element ordered after key.
+  iterator upper_bound(const key_type &key) const {
+    iterator it = lower_bound(key);
+    if (it != end() && !comp_(key, KeyOf()(*it))) ++it;
+    return it;
+  }
+
+ private:
+  Node *head_;
+  std::atomic<size_type> size_;
+  Compare comp_;
+
+  static std::atomic<std::uintptr_t> *Next(Node *node) {
+    return reinterpret_cast<std::atomic<std::uintptr_t> *>(node + 1);
+  }
+
+  static bool IsMarked(std::uintptr_t link) { return link & 1; }
+
+  static Node *Unmark(std::uintptr_t link) {
+    return reinterpret_cast<Node *>(link & ~std::uintptr_t(1));
+  }
+
+  static std::uintptr_t Raw(Node *node) {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+
+  // Skips nodes already marked at level, without unlinking them.
+  static Node *NextAlive(Node *node, int level) {
+    while (node != nullptr) {
+      std::uintptr_t next = Next(node)[level].load(std::memory_order_acquire);
+      if (!IsMarked(next)) break;
+      node = Unmark(next);
+    }
+    return node;
+  }
+
+  static Node *AllocateNode(int height) {
+    void *memory = ::operator new(
+        sizeof(Node) + height * sizeof(std::atomic<std::uintptr_t>));
+    Node *node = static_cast<Node *>(memory);
+    node->height = height;
+    new (&node->fully_linked) std::atomic<bool>(false);
+    return node;
+  }
+
+  static Node *CreateNode(const value_type &value, int height) {
+    Node *node = AllocateNode(height);
+    try {
+      new (&node->value) value_type(value);
+    } catch (...) {
+      ::operator delete(node);
+      throw;
+    }
+    for (int level = 0; level < height; ++level) {
+      new (Next(node) + level) std::atomic<std::uintptr_t>(0);
+    }
+    return node;
+  }
+
+  static void DestroyNode(Node *node) {
+    node->value.~value_type();
+    ::operator delete(node);
+  }
+
+  static void DestroyErased(void *node) {
+    DestroyNode(static_cast<Node *>(node));
+  }
+
+  // Geometric with p = 1/2 from a per-thread xorshift generator.
+  static int RandomHeight() {
+    thread_local std::uint64_t state =
+        std::hash<std::thread::id>()(std::this_thread::get_id()) |
+        0x9e3779b97f4a7c15ULL;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    int height = 1;
+    for (std::uint64_t bits = state; (bits & 1) && height < kMaxLevel;
+         bits >>= 1) {
+      ++height;
+    }
+    return height;
+  }
+
+  // Fills preds and succs with the neighbours of key on every level,
+  // unlinking marked nodes on the way, and reports whether succs[0] holds
+  // key. Restarts from the head when a CAS loses to a concurrent change.
+  bool Find(const key_type &key, Node **preds, Node **succs) {
+  retry:
+    Node *pred = head_;
+    for (int level = kMaxLevel - 1; level >= 0; --level) {
+      std::uintptr_t link = Next(pred)[level].load(std::memory_order_acquire);
+      if (IsMarked(link)) goto retry;
+      Node *curr = Unmark(link);
+      while (curr != nullptr) {
+        std::uintptr_t next =
+            Next(curr)[level].load(std::memory_order_acquire);
+        if (IsMarked(next)) {
+          std::uintptr_t expected = Raw(curr);
+          if (!Next(pred)[level].compare_exchange_strong(
+                  expected, next & ~std::uintptr_t(1),
+                  std::memory_order_acq_rel)) {
+            goto retry;
+          }
+          curr = Unmark(next);
+        } else if (comp_(KeyOf()(curr->value), key)) {
+          pred = curr;
+          curr = Unmark(next);
+        } else {
+          break;
+        }
+      }
+      preds[level] = pred;
+      succs[level] = curr;
+    }
+    return succs[0] != nullptr && !comp_(key, KeyOf()(succs[0]->value));
+  }
+
+  // Unlinks victim, marked on every level, from every level, so that no new
+  // traversal can reach it once this returns. Find stops at the first node
+  // not ordered before the key, which may be a new node with the same key in
+  // front of the victim; this scans the whole run of equal keys instead.
+  void Unlink(Node *victim) {
+    const key_type &key = KeyOf()(victim->value);
+  retry:
+    Node *pred = head_;
+    for (int level = kMaxLevel - 1; level >= 0; --level) {
+      // pred is ordered before key; prev walks the run of equal keys.
+      Node *prev = pred;
+      std::uintptr_t link = Next(prev)[level].load(std::memory_order_acquire);
+      if (IsMarked(link)) goto retry;
+      Node *curr = Unmark(link);
+      while (curr != nullptr) {
+        std::uintptr_t next =
+            Next(curr)[level].load(std::memory_order_acquire);
+        if (IsMarked(next)) {
+          std::uintptr_t expected = Raw(curr);
+          if (!Next(prev)[level].compare_exchange_strong(
+                  expected, next & ~std::uintptr_t(1),
+                  std::memory_order_acq_rel)) {
+            goto retry;
+          }
+          curr = Unmark(next);
+        } else if (comp_(KeyOf()(curr->value), key)) {
+          pred = prev = curr;
+          curr = Unmark(next);
+        } else if (!comp_(key, KeyOf()(curr->value))) {
+          prev = curr;
+          curr = Unmark(next);
+        } else {
+          break;
+        }
+      }
+    }
+  }
+};
+
+namespace skip_list {
+
+template <class Key>
+struct Identity {
+  const Key &operator()(const Key &key) const { return key; }
+};
+
+template <class Pair>
+struct First {
+  const typename Pair::first_type &operator()(const Pair &pair) const {
+    return pair.first;
+  }
+};
+
+}  // namespace skip_list
+
+// Ordered set for many concurrent readers and writers.
+template <class Key, class Compare = std::less<Key>>
+class ConcurrentSkipListSet
+    : public ConcurrentSkipList<Key, Key, skip_list::Identity<Key>, Compare> {
+  using Base =
+      ConcurrentSkipList<Key, Key, skip_list::Identity<Key>, Compare>;
+
+ public:
+  ConcurrentSkipListSet() {}
+
+  explicit ConcurrentSkipListSet(const Compare &comp) : Base(comp) {}
+
+  ConcurrentSkipListSet(std::initializer_list<Key> const &items) {
+    for (const Key &item : items) this->insert(item);
+  }
+};
+
+// Ordered map for many concurrent readers and writers. Mapped values are
+// written once, on insertion; use an atomic mapped_type to update them in
+// place.
+template <class Key, class T, class Compare = std::less<Key>>
+class ConcurrentSkipListMap
+    : public ConcurrentSkipList<Key, std::pair<const Key, T>,
+                                skip_list::First<std::pair<const Key, T>>,
+                                Compare> {
+  using Base =
+      ConcurrentSkipList<Key, std::pair<const Key, T>,
+                         skip_list::First<std::pair<const Key, T>>, Compare>;
+
+ public:
+  using mapped_type = T;
+  using typename Base::value_type;
+
+  ConcurrentSkipListMap() {}
+
+  explicit ConcurrentSkipListMap(const Compare &comp) : Base(comp) {}
+
+  ConcurrentSkipListMap(std::initializer_list<value_type> const &items) {
+    for (const value_type &item : items) this->insert(item);
+  }
+
+  using Base::insert;
+
+  std::pair<typename Base::iterator, bool> insert(const Key &key,
+                                                  const T &obj) {
+    return this->insert(value_type(key, obj));
+  }
+
+  // Returns a copy: the element may be erased as soon as the call returns.
+  T at(const Key &key) const {
+    auto it = this->find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("s21::ConcurrentSkipListMap::at key not found");
+    }
+    return it->second;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_CONCURRENT_SKIP_LIST_H_
@@ -1,6 +1,25 @@
 #ifndef CPP2_S21_CONTAINERS_1_SRC_S21_CONTAINERSPLUS_H_
 #define CPP2_S21_CONTAINERS_1_SRC_S21_CONTAINERSPLUS_H_
 
+#include "s21_addressable_heap.h"
+#include "s21_aligned.h"
+#include "s21_alloc_stats.h"
 #include "s21_array.h"
+#include "s21_channel.h"
+#include "s21_concurrent_skip_list.h"
+#include "s21_intrusive.h"
+#include "s21_md_array.h"
+#include "s21_mmap_vector.h"
+#include "s21_mpmc_queue.h"
+#include "s21_pmr.h"
+#include "s21_priority_queue.h"
+#include "s21_ring_buffer.h"
+#include "s21_serialize.h"
+#include "s21_spsc_queue.h"
+#include "s21_static_map.h"
+#include "s21_static_vector.h"
+#include "s21_stats.h"
+#include "s21_unrolled_list.h"
+#include "s21_work_stealing_deque.h"
 
 #endif  // CPP2_S21_CONTAINERS_1_SRC_S21_CONTAINERSPLUS_H_
\ No newline at end of file
@@ -1,25 +1,170 @@
 #ifndef CPP2_S21_CONTAINERS_1_SRC_S21_DEQUE_H_
 #define CPP2_S21_CONTAINERS_1_SRC_S21_DEQUE_H_
 
-#include <iostream>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_alloc_stats.h"
 
 namespace s21 {
 
-template <class T>
+// Elements live in fixed-size blocks reached through a map of block
+// pointers, so indexing is two loads and pushing at either end never moves
+// an element: references stay valid until their element is popped. Only
+// the map is reallocated, and it is recentred whenever it runs out of room
+// at one end.
+template <class T,
+          class Allocator = DefaultAllocator<T, alloc_stats::DequeTag>>
 class Deque {
  public:
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  static constexpr size_type kBlockSize =
+      sizeof(T) <= 32 ? 512 / sizeof(T) : 16;
+
+  // Raw storage for one block. Blocks are allocated one at a time through
+  // the allocator rebound to this type, so a node pool can serve them.
+  struct block_type {
+    alignas(T) unsigned char bytes[kBlockSize * sizeof(T)];
+  };
+
+  class DequeIterator {
+    friend Deque;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    DequeIterator() = default;
+
+    reference operator*() const { return *deque_->Slot(pos_); }
+
+    pointer operator->() const { return deque_->Slot(pos_); }
+
+    reference operator[](difference_type n) const {
+      return *deque_->Slot(pos_ + n);
+    }
+
+    DequeIterator &operator++() {
+      ++pos_;
+      return *this;
+    }
+
+    DequeIterator operator++(int) {
+      DequeIterator tmp = *this;
+      ++pos_;
+      return tmp;
+    }
+
+    DequeIterator &operator--() {
+      --pos_;
+      return *this;
+    }
+
+    DequeIterator operator--(int) {
+      DequeIterator tmp = *this;
+      --pos_;
+      return tmp;
+    }
+
+    DequeIterator &operator+=(difference_type n) {
+      pos_ += n;
+      return *this;
+    }
+
+    DequeIterator &operator-=(difference_type n) {
+      pos_ -= n;
+      return *this;
+    }
+
+    DequeIterator operator+(difference_type n) const {
+      return DequeIterator(deque_, pos_ + n);
+    }
+
+    friend DequeIterator operator+(difference_type n, const DequeIterator &it) {
+      return it + n;
+    }
+
+    DequeIterator operator-(difference_type n) const {
+      return DequeIterator(deque_, pos_ - n);
+    }
+
+    difference_type operator-(const DequeIterator &other) const {
+      return static_cast<difference_type>(pos_) -
+             static_cast<difference_type>(other.pos_);
+    }
+
+    bool operator==(const DequeIterator &other) const {
+      return pos_ == other.pos_;
+    }
+
+    bool operator!=(const DequeIterator &other) const {
+      return pos_ != other.pos_;
+    }
+
+    bool operator<(const DequeIterator &other) const {
+      return pos_ < other.pos_;
+    }
+
+    bool operator>(const DequeIterator &other) const {
+      return pos_ > other.pos_;
+    }
 
-  struct Node {
-    value_type val;
-    Node *prev;
-    Node *next;
+    bool operator<=(const DequeIterator &other) const {
+      return pos_ <= other.pos_;
+    }
+
+    bool operator>=(const DequeIterator &other) const {
+      return pos_ >= other.pos_;
+    }
+
+   private:
+    // pos_ counts slots from the start of the map, not from the front
+    // element, so iterators survive pushes that do not recentre the map.
+    DequeIterator(const Deque *deque, size_type pos)
+        : deque_(deque), pos_(pos) {}
+
+    const Deque *deque_ = nullptr;
+    size_type pos_ = 0;
+  };
+
+  class DequeConstIterator : public DequeIterator {
+   public:
+    using reference = const T &;
+    using pointer = const T *;
+
+    DequeConstIterator() : DequeIterator() {}
+    DequeConstIterator(const DequeIterator &it) : DequeIterator(it) {}
+
+    const_reference operator*() const { return DequeIterator::operator*(); }
+
+    const value_type *operator->() const {
+      return DequeIterator::operator->();
+    }
+
+    const_reference operator[](std::ptrdiff_t n) const {
+      return DequeIterator::operator[](n);
+    }
   };
 
-  Deque() : head(nullptr), tail(nullptr), deq_size(0) {}
+  using iterator = DequeIterator;
+  using const_iterator = DequeConstIterator;
+
+  Deque() : Deque(allocator_type()) {}
+
+  explicit Deque(const allocator_type &alloc)
+      : map(nullptr), map_size(0), first(0), deq_size(0), alloc(alloc) {}
 
   Deque(std::initializer_list<value_type> const &items) : Deque() {
     for (auto i = items.begin(); i != items.end(); i++) {
@@ -27,115 +172,231 @@ class Deque {
     }
   }
 
-  Deque(const Deque &other) : Deque() {
-    for (size_type i = 0U; i < other.size(); i++) {
-      push_back(other[i]->val);
+  Deque(const Deque &other)
+      : Deque(other, traits::select_on_container_copy_construction(
+                         other.alloc)) {}
+
+  Deque(const Deque &other, const allocator_type &alloc) : Deque(alloc) {
+    for (const_reference value : other) push_back(value);
+  }
+
+  Deque(Deque &&other) : Deque(other.alloc) { swap(other); }
+
+  // Takes the blocks only when alloc can free them.
+  Deque(Deque &&other, const allocator_type &alloc) : Deque(alloc) {
+    if (this->alloc == other.alloc) {
+      swap(other);
+    } else {
+      for (reference value : other) emplace_back(std::move(value));
     }
   }
 
-  Deque(Deque &&other) : Deque() { swap(other); }
+  ~Deque() { Release(); }
 
-  ~Deque() {
-    if (!empty()) {
-      Node *ptr = head;
-      while (ptr) {
-        Node *tmp = ptr->next;
-        delete ptr;
-        ptr = tmp;
+  Deque &operator=(const Deque &other) {
+    if (this != &other) {
+      if constexpr (traits::propagate_on_container_copy_assignment::value) {
+        if (alloc != other.alloc) Release();
+        alloc = other.alloc;
       }
+      Deque tmp(other, alloc);
+      swap(tmp);
     }
-    deq_size = 0;
+    return *this;
   }
 
   Deque &operator=(Deque &&other) {
-    swap(other);
-    other.~Deque();
+    if (this != &other) {
+      if (traits::propagate_on_container_move_assignment::value ||
+          alloc == other.alloc) {
+        clear();
+        swap(other);
+      } else {
+        Deque tmp(std::move(other), alloc);
+        swap(tmp);
+      }
+    }
     return *this;
   }
 
-  Node *operator[](const size_type index) const {
-    if (head == nullptr) return nullptr;
-    Node *tmp = head;
-    for (size_type i = 0; i < index; i++) {
-      tmp = tmp->next;
-      if (tmp == nullptr) return nullptr;
-    }
-    return tmp;
+  reference operator[](const size_type index) { return At(first + index); }
+
+  const_reference operator[](const size_type index) const {
+    return At(first + index);
+  }
+
+  reference at(const size_type index) {
+    if (index >= deq_size) throw std::out_of_range("s21::Deque::at");
+    return At(first + index);
+  }
+
+  const_reference at(const size_type index) const {
+    if (index >= deq_size) throw std::out_of_range("s21::Deque::at");
+    return At(first + index);
   }
 
-  const_reference begin() { return head->val; }
+  reference front() { return At(first); }
+  const_reference front() const { return At(first); }
+
+  reference back() { return At(first + deq_size - 1); }
+  const_reference back() const { return At(first + deq_size - 1); }
 
-  const_reference end() { return tail->val; }
+  iterator begin() { return iterator(this, first); }
+  iterator end() { return iterator(this, first + deq_size); }
 
-  bool empty() { return head == nullptr; }
+  const_iterator begin() const { return iterator(this, first); }
+  const_iterator end() const { return iterator(this, first + deq_size); }
+
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return deq_size == 0; }
 
   size_type size() const { return deq_size; }
 
-  void push_back(const_reference val) {
-    std::unique_ptr<Node> ptr(new Node());
-    ptr.get()->val = val;
-    if (empty()) {
-      head = tail = ptr.get();
-    } else {
-      tail->next = ptr.get();
-      ptr->prev = tail;
-      tail = ptr.get();
-    }
-    ptr.release();
-    deq_size++;
+  size_type max_size() const { return traits::max_size(alloc); }
+
+  void push_back(const_reference val) { emplace_back(val); }
+
+  void push_front(const_reference val) { emplace_front(val); }
+
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    if (first + deq_size == map_size * kBlockSize) GrowMap();
+    size_type pos = first + deq_size;
+    Construct(pos, std::forward<Args>(args)...);
+    ++deq_size;
+    return At(pos);
   }
 
-  void push_front(const_reference val) {
-    std::unique_ptr<Node> ptr(new Node());
-    ptr.get()->val = val;
-    if (empty()) {
-      head = tail = ptr.get();
-    } else {
-      head->prev = ptr.get();
-      ptr->next = head;
-      head = ptr.get();
-    }
-    ptr.release();
-    deq_size++;
+  template <class... Args>
+  reference emplace_front(Args &&...args) {
+    if (first == 0) GrowMap();
+    Construct(first - 1, std::forward<Args>(args)...);
+    --first;
+    ++deq_size;
+    return At(first);
   }
 
-  Node *pop_back() {
-    if (empty()) return nullptr;
-    std::unique_ptr<Node> buff(tail);
-    if (tail->prev == nullptr) {
-      tail = head = nullptr;
-    } else {
-      tail = tail->prev;
-    }
-    deq_size--;
-    return buff.get();
+  void pop_back() {
+    if (empty()) return;
+    size_type pos = first + --deq_size;
+    traits::destroy(alloc, &At(pos));
+    if (pos % kBlockSize == 0 || deq_size == 0) ReleaseBlock(pos);
   }
 
-  Node *pop_front() {
-    if (empty()) return nullptr;
-    std::unique_ptr<Node> buff(head);
-    if (head->next == nullptr) {
-      tail = head = nullptr;
-    } else {
-      head = head->next;
-    }
-    deq_size--;
-    return buff.get();
+  void pop_front() {
+    if (empty()) return;
+    size_type pos = first++;
+    --deq_size;
+    traits::destroy(alloc, &At(pos));
+    if (first % kBlockSize == 0 || deq_size == 0) ReleaseBlock(pos);
   }
 
+  void clear() {
+    while (!empty()) pop_back();
+  }
+
+  allocator_type get_allocator() const { return alloc; }
+
   void swap(Deque &other) {
-    std::swap(head, other.head);
-    std::swap(tail, other.tail);
+    std::swap(map, other.map);
+    std::swap(map_size, other.map_size);
+    std::swap(first, other.first);
     std::swap(deq_size, other.deq_size);
+    if constexpr (traits::propagate_on_container_swap::value) {
+      std::swap(alloc, other.alloc);
+    }
   }
 
  private:
-  Node *head;
-  Node *tail;
+  using traits = std::allocator_traits<Allocator>;
+  using map_allocator = typename traits::template rebind_alloc<T *>;
+  using map_traits = std::allocator_traits<map_allocator>;
+  using block_allocator = typename traits::template rebind_alloc<block_type>;
+  using block_traits = std::allocator_traits<block_allocator>;
+
+  static constexpr size_type kMinMapSize = 8;
 
+  T **map;
+  size_type map_size;
+  // Slot of the front element, counted from the start of the map.
+  size_type first;
   size_type deq_size;
+  allocator_type alloc;
+
+  T *Slot(size_type pos) const {
+    return map[pos / kBlockSize] + pos % kBlockSize;
+  }
+
+  reference At(size_type pos) { return *Slot(pos); }
+  const_reference At(size_type pos) const { return *Slot(pos); }
+
+  map_allocator MapAllocator() const { return map_allocator(alloc); }
+
+  // Frees the elements, their blocks and the map.
+  void Release() {
+    clear();
+    if (map != nullptr) {
+      map_allocator map_alloc = MapAllocator();
+      map_traits::deallocate(map_alloc, map, map_size);
+    }
+    map = nullptr;
+    map_size = 0;
+    first = 0;
+  }
+
+  template <class... Args>
+  void Construct(size_type pos, Args &&...args) {
+    T *&block = map[pos / kBlockSize];
+    bool fresh = block == nullptr;
+    if (fresh) {
+      block_allocator block_alloc(alloc);
+      block = reinterpret_cast<T *>(block_traits::allocate(block_alloc, 1));
+    }
+    try {
+      traits::construct(alloc, block + pos % kBlockSize,
+                        std::forward<Args>(args)...);
+    } catch (...) {
+      if (fresh) ReleaseBlock(pos);
+      throw;
+    }
+  }
+
+  void ReleaseBlock(size_type pos) {
+    T *&block = map[pos / kBlockSize];
+    block_allocator block_alloc(alloc);
+    block_traits::deallocate(block_alloc, reinterpret_cast<block_type *>(block),
+                             1);
+    block = nullptr;
+    if (deq_size == 0) first = map_size / 2 * kBlockSize;
+  }
+
+  // Moves the block pointers to the middle of a map twice as large as the
+  // blocks in use, which leaves free slots at both ends.
+  void GrowMap() {
+    size_type first_block = first / kBlockSize;
+    size_type blocks = 0;
+    if (deq_size != 0) {
+      blocks = (first + deq_size - 1) / kBlockSize + 1 - first_block;
+    }
+    size_type new_size = 2 * blocks + 2;
+    if (new_size < kMinMapSize) new_size = kMinMapSize;
+    map_allocator map_alloc = MapAllocator();
+    T **new_map = map_traits::allocate(map_alloc, new_size);
+    size_type offset = (new_size - blocks) / 2;
+    for (size_type i = 0; i < new_size; ++i) new_map[i] = nullptr;
+    for (size_type i = 0; i < blocks; ++i) {
+      new_map[offset + i] = map[first_block + i];
+    }
+    if (map != nullptr) map_traits::deallocate(map_alloc, map, map_size);
+    size_type in_block = deq_size == 0 ? kBlockSize / 2 : first % kBlockSize;
+    map = new_map;
+    map_size = new_size;
+    first = offset * kBlockSize + in_block;
+  }
 };
 
 }  // namespace s21
 
-#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_DEQUE_H_
\ No newline at end of file
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_DEQUE_H_
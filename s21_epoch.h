@@ -0,0 +1,165 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_EPOCH_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_EPOCH_H_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "s21_node_pool.h"
+
+namespace s21 {
+
+// Epoch-based reclamation for the lock-free containers. Readers pin the
+// current epoch with a Guard; unlinked memory is handed to Retire and freed
+// once the global epoch has moved two steps past the retirement, which can
+// only happen after every thread that could still see it has unpinned.
+class Epoch {
+ public:
+  // Pins the calling thread for its lifetime. Guards nest and are cheap to
+  // copy, but must stay on the thread that created them.
+  class Guard {
+   public:
+    Guard() { Enter(); }
+    Guard(const Guard &) { Enter(); }
+    Guard &operator=(const Guard &) { return *this; }
+    ~Guard() { Leave(); }
+  };
+
+  // Queues ptr to be released by deleter when no guard can still reach it.
+  static void Retire(void *ptr, void (*deleter)(void *)) {
+    Record &record = Local();
+    record.limbo.push_back({ptr, deleter, Current()});
+    if (record.limbo.size() % kCollectEvery == 0) Collect(record);
+  }
+
+  // Tries to advance the epoch and frees what the calling thread retired
+  // long enough ago.
+  static void Collect() { Collect(Local()); }
+
+  static std::uint64_t Current() {
+    return Global().load(std::memory_order_acquire);
+  }
+
+ private:
+  struct Retired {
+    void *ptr;
+    void (*deleter)(void *);
+    std::uint64_t epoch;
+  };
+
+  // The state word is epoch << 1 | 1 while pinned, 0 otherwise. Records are
+  // never freed while the program runs; a record released by an exiting
+  // thread is reused, limbo included, by the next thread that registers.
+  struct alignas(kCacheLineSize) Record {
+    std::atomic<std::uint64_t> state{0};
+    std::atomic<bool> in_use{true};
+    Record *next = nullptr;
+    unsigned nesting = 0;
+    std::vector<Retired> limbo;
+  };
+
+  struct Registry {
+    std::atomic<Record *> head{nullptr};
+
+    ~Registry() {
+      Record *record = head.load();
+      while (record != nullptr) {
+        for (auto &retired : record->limbo) retired.deleter(retired.ptr);
+        Record *next = record->next;
+        delete record;
+        record = next;
+      }
+    }
+  };
+
+  struct Holder {
+    Record *record;
+
+    Holder() : record(Acquire()) {}
+
+    ~Holder() {
+      Collect(*record);
+      record->state.store(0, std::memory_order_release);
+      record->in_use.store(false, std::memory_order_release);
+    }
+  };
+
+  static constexpr std::size_t kCollectEvery = 64;
+
+  static std::atomic<std::uint64_t> &Global() {
+    static std::atomic<std::uint64_t> epoch{1};
+    return epoch;
+  }
+
+  static Registry &Records() {
+    static Registry registry;
+    return registry;
+  }
+
+  static Record &Local() {
+    thread_local Holder holder;
+    return *holder.record;
+  }
+
+  static Record *Acquire() {
+    Registry &registry = Records();
+    for (Record *record = registry.head.load(std::memory_order_acquire);
+         record != nullptr; record = record->next) {
+      bool expected = false;
+      if (record->in_use.compare_exchange_strong(expected, true,
+                                                 std::memory_order_acquire)) {
+        return record;
+      }
+    }
+    Record *record = new Record();
+    record->next = registry.head.load(std::memory_order_relaxed);
+    while (!registry.head.compare_exchange_weak(record->next, record,
+                                                std::memory_order_release)) {
+    }
+    return record;
+  }
+
+  static void Enter() {
+    Record &record = Local();
+    if (record.nesting++ == 0) {
+      std::uint64_t epoch = Global().load(std::memory_order_seq_cst);
+      record.state.store(epoch << 1 | 1, std::memory_order_seq_cst);
+    }
+  }
+
+  static void Leave() {
+    Record &record = Local();
+    if (--record.nesting == 0) {
+      record.state.store(0, std::memory_order_release);
+    }
+  }
+
+  static void Collect(Record &record) {
+    std::uint64_t epoch = Global().load(std::memory_order_seq_cst);
+    bool quiescent = true;
+    for (Record *other = Records().head.load(std::memory_order_acquire);
+         other != nullptr && quiescent; other = other->next) {
+      std::uint64_t state = other->state.load(std::memory_order_seq_cst);
+      quiescent = !(state & 1) || (state >> 1) == epoch;
+    }
+    if (quiescent) {
+      Global().compare_exchange_strong(epoch, epoch + 1,
+                                       std::memory_order_seq_cst);
+    }
+    std::uint64_t now = Global().load(std::memory_order_acquire);
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < record.limbo.size(); ++i) {
+      Retired retired = record.limbo[i];
+      if (retired.epoch + 2 <= now) {
+        retired.deleter(retired.ptr);
+      } else {
+        record.limbo[kept++] = retired;
+      }
+    }
+    record.limbo.resize(kept);
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_EPOCH_H_
@@ -0,0 +1,416 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_INTRUSIVE_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_INTRUSIVE_H_
+
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_binary_tree.h"
+#include "s21_list.h"
+
+namespace s21 {
+
+// Hooks are embedded by deriving from them; the Tag tells apart several
+// hooks of the same kind in one type.
+template <class Tag = void>
+struct list_hook {
+  list_hook *prev_ = nullptr;
+  list_hook *next_ = nullptr;
+};
+
+template <class Tag = void>
+struct tree_hook {
+  tree_hook *left = nullptr;
+  tree_hook *right = nullptr;
+  tree_hook *parent = nullptr;
+  bool is_fake = false;
+};
+
+// List of objects the caller owns. Linking and unlinking never allocates or
+// copies, and an object can be removed in O(1) from a reference to it. The
+// objects must outlive their membership in the list.
+template <class T, class Tag = void>
+class IntrusiveList {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using hook_type = list_hook<Tag>;
+
+  class IntrusiveListIterator {
+    friend IntrusiveList;
+
+   public:
+    IntrusiveListIterator() = default;
+    explicit IntrusiveListIterator(hook_type *ptr) : ptr(ptr) {}
+
+    reference operator*() const { return *ToValue(ptr); }
+
+    value_type *operator->() const { return ToValue(ptr); }
+
+    IntrusiveListIterator &operator++() {
+      ptr = ptr->next_;
+      return *this;
+    }
+
+    IntrusiveListIterator operator++(int) {
+      IntrusiveListIterator tmp = *this;
+      ptr = ptr->next_;
+      return tmp;
+    }
+
+    IntrusiveListIterator &operator--() {
+      ptr = ptr->prev_;
+      return *this;
+    }
+
+    bool operator==(const IntrusiveListIterator &other) const {
+      return ptr == other.ptr;
+    }
+
+    bool operator!=(const IntrusiveListIterator &other) const {
+      return ptr != other.ptr;
+    }
+
+   private:
+    hook_type *ptr = nullptr;
+  };
+
+  using iterator = IntrusiveListIterator;
+
+  IntrusiveList() : head_(nullptr), tail_(nullptr), size_(0) {}
+
+  IntrusiveList(const IntrusiveList &) = delete;
+
+  IntrusiveList(IntrusiveList &&l) : IntrusiveList() { swap(l); }
+
+  ~IntrusiveList() { clear(); }
+
+  IntrusiveList &operator=(IntrusiveList &&l) {
+    clear();
+    swap(l);
+    return *this;
+  }
+
+  iterator begin() { return iterator(head_); }
+  iterator end() { return iterator(nullptr); }
+
+  reference front() { return *ToValue(head_); }
+
+  reference back() { return *ToValue(tail_); }
+
+  bool empty() { return head_ == nullptr; }
+
+  size_type size() { return size_; }
+
+  iterator iterator_to(reference value) { return iterator(ToHook(value)); }
+
+  void push_back(reference value) { insert(end(), value); }
+
+  void push_front(reference value) { insert(begin(), value); }
+
+  void pop_back() {
+    if (tail_ != nullptr) erase(iterator(tail_));
+  }
+
+  void pop_front() {
+    if (head_ != nullptr) erase(begin());
+  }
+
+  iterator insert(iterator pos, reference value) {
+    hook_type *hook = ToHook(value);
+    ListLinks<hook_type>::LinkBefore(head_, tail_, pos.ptr, hook, hook);
+    ++size_;
+    return iterator(hook);
+  }
+
+  // Unlinks the object at pos and returns the iterator following it.
+  iterator erase(iterator pos) {
+    hook_type *next = pos.ptr->next_;
+    ListLinks<hook_type>::Unlink(head_, tail_, pos.ptr, pos.ptr);
+    --size_;
+    return iterator(next);
+  }
+
+  void remove(reference value) { erase(iterator_to(value)); }
+
+  // Unlinks every object; the objects themselves are left alone.
+  void clear() {
+    while (head_ != nullptr) {
+      hook_type *next = head_->next_;
+      head_->prev_ = head_->next_ = nullptr;
+      head_ = next;
+    }
+    tail_ = nullptr;
+    size_ = 0;
+  }
+
+  void swap(IntrusiveList &other) {
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
+  }
+
+  void splice(iterator pos, IntrusiveList &other) {
+    if (this == &other || other.head_ == nullptr) return;
+    ListLinks<hook_type>::LinkBefore(head_, tail_, pos.ptr, other.head_,
+                                     other.tail_);
+    size_ += other.size_;
+    other.head_ = other.tail_ = nullptr;
+    other.size_ = 0;
+  }
+
+  void splice(iterator pos, IntrusiveList &other, iterator it) {
+    if (this == &other && (it == pos || it.ptr->next_ == pos.ptr)) return;
+    other.erase(it);
+    insert(pos, *it);
+  }
+
+  void reverse() { ListLinks<hook_type>::Reverse(head_, tail_); }
+
+  void sort() { sort(std::less<value_type>()); }
+
+  template <class Compare>
+  void sort(Compare comp) {
+    ListLinks<hook_type>::Sort(head_, tail_, HookLess<Compare>(comp));
+  }
+
+  void merge(IntrusiveList &other) { merge(other, std::less<value_type>()); }
+
+  template <class Compare>
+  void merge(IntrusiveList &other, Compare comp) {
+    if (this == &other) return;
+    ListLinks<hook_type>::Merge(head_, tail_, other.head_, other.tail_,
+                                HookLess<Compare>(comp));
+    size_ += other.size_;
+    other.size_ = 0;
+  }
+
+ private:
+  hook_type *head_;
+  hook_type *tail_;
+  size_type size_;
+
+  template <class Compare>
+  struct HookLess {
+    explicit HookLess(Compare &comp) : comp(comp) {}
+    bool operator()(hook_type *a, hook_type *b) {
+      return comp(*ToValue(a), *ToValue(b));
+    }
+    Compare &comp;
+  };
+
+  static value_type *ToValue(hook_type *hook) {
+    return static_cast<value_type *>(hook);
+  }
+
+  static hook_type *ToHook(reference value) {
+    return &static_cast<hook_type &>(value);
+  }
+};
+
+// Ordered set of objects the caller owns, linked through an embedded
+// tree_hook with the BinaryTree algorithms. Keys must not change while an
+// object is linked.
+template <class T, class Compare = std::less<T>, class Tag = void>
+class IntrusiveSet {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using hook_type = tree_hook<Tag>;
+
+  class IntrusiveSetIterator {
+    friend IntrusiveSet;
+
+   public:
+    IntrusiveSetIterator() = default;
+    explicit IntrusiveSetIterator(hook_type *ptr) : ptr(ptr) {}
+
+    reference operator*() const { return *ToValue(ptr); }
+
+    value_type *operator->() const { return ToValue(ptr); }
+
+    IntrusiveSetIterator &operator++() {
+      ptr = TreeLinks<hook_type>::Next(ptr);
+      return *this;
+    }
+
+    IntrusiveSetIterator operator++(int) {
+      IntrusiveSetIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    IntrusiveSetIterator &operator--() {
+      ptr = TreeLinks<hook_type>::Prev(ptr);
+      return *this;
+    }
+
+    bool operator==(const IntrusiveSetIterator &other) const {
+      return ptr == other.ptr;
+    }
+
+    bool operator!=(const IntrusiveSetIterator &other) const {
+      return ptr != other.ptr;
+    }
+
+   private:
+    hook_type *ptr = nullptr;
+  };
+
+  using iterator = IntrusiveSetIterator;
+
+  IntrusiveSet() : IntrusiveSet(Compare()) {}
+
+  explicit IntrusiveSet(const Compare &comp)
+      : root_(nullptr), size_(0), comp_(comp) {
+    MakeRootFake();
+  }
+
+  IntrusiveSet(const IntrusiveSet &) = delete;
+
+  IntrusiveSet &operator=(const IntrusiveSet &) = delete;
+
+  ~IntrusiveSet() { clear(); }
+
+  iterator begin() { return iterator(TreeLinks<hook_type>::MinNode(root_)); }
+
+  iterator end() { return iterator(&fake_); }
+
+  bool empty() { return root_->is_fake; }
+
+  size_type size() { return size_; }
+
+  iterator iterator_to(reference value) { return iterator(ToHook(value)); }
+
+  // An object already in this set is reported as the equal element; one
+  // linked into another set through the same hook is rejected.
+  std::pair<iterator, bool> insert(reference value) {
+    hook_type *hook = ToHook(value);
+    if (IsLinked(hook)) {
+      if (RootOf(hook) != root_) {
+        throw std::invalid_argument(
+            "s21::IntrusiveSet::insert: object is linked into another set");
+      }
+      return std::make_pair(iterator(hook), false);
+    }
+    hook_type *existing = TreeLinks<hook_type>::Link(root_, hook, Less());
+    if (existing != nullptr) return std::make_pair(iterator(existing), false);
+    ++size_;
+    TreeLinks<hook_type>::AttachFake(root_, &fake_);
+    return std::make_pair(iterator(hook), true);
+  }
+
+  // Unlinks the object at pos and returns the iterator following it.
+  iterator erase(iterator pos) {
+    hook_type *next = TreeLinks<hook_type>::Next(pos.ptr);
+    TreeLinks<hook_type>::Erase(root_, pos.ptr);
+    ResetHook(pos.ptr);
+    --size_;
+    if (root_ != nullptr)
+      TreeLinks<hook_type>::AttachFake(root_, &fake_);
+    else
+      MakeRootFake();
+    return iterator(next);
+  }
+
+  void erase(reference value) { erase(iterator_to(value)); }
+
+  iterator find(const_reference key) {
+    hook_type *node = root_;
+    while (TreeLinks<hook_type>::Real(node)) {
+      if (comp_(key, *ToValue(node))) {
+        node = node->left;
+      } else if (comp_(*ToValue(node), key)) {
+        node = node->right;
+      } else {
+        return iterator(node);
+      }
+    }
+    return end();
+  }
+
+  bool contains(const_reference key) { return find(key) != end(); }
+
+  // First object not ordered before key.
+  iterator lower_bound(const_reference key) {
+    hook_type *node = root_;
+    hook_type *result = &fake_;
+    while (TreeLinks<hook_type>::Real(node)) {
+      if (comp_(*ToValue(node), key)) {
+        node = node->right;
+      } else {
+        result = node;
+        node = node->left;
+      }
+    }
+    return iterator(result);
+  }
+
+  // Unlinks every object; the objects themselves are left alone.
+  void clear() {
+    if (!root_->is_fake) ResetTree(root_);
+    MakeRootFake();
+    size_ = 0;
+  }
+
+ private:
+  hook_type *root_;
+  hook_type fake_;
+  size_type size_;
+  Compare comp_;
+
+  struct HookLess {
+    explicit HookLess(Compare &comp) : comp(comp) {}
+    bool operator()(hook_type *a, hook_type *b) {
+      return comp(*ToValue(a), *ToValue(b));
+    }
+    Compare &comp;
+  };
+
+  HookLess Less() { return HookLess(comp_); }
+
+  static value_type *ToValue(hook_type *hook) {
+    return static_cast<value_type *>(hook);
+  }
+
+  static hook_type *ToHook(reference value) {
+    return &static_cast<hook_type &>(value);
+  }
+
+  // Unlinked hooks have all links cleared; a linked one has a parent or,
+  // as the root, at least the fake node to its right.
+  static bool IsLinked(const hook_type *hook) {
+    return hook->parent != nullptr || hook->right != nullptr;
+  }
+
+  static hook_type *RootOf(hook_type *hook) {
+    while (hook->parent != nullptr) hook = hook->parent;
+    return hook;
+  }
+
+  static void ResetHook(hook_type *hook) {
+    hook->left = hook->right = hook->parent = nullptr;
+  }
+
+  void ResetTree(hook_type *node) {
+    if (node->left) ResetTree(node->left);
+    if (TreeLinks<hook_type>::Real(node->right)) ResetTree(node->right);
+    ResetHook(node);
+  }
+
+  void MakeRootFake() {
+    fake_.is_fake = true;
+    fake_.parent = fake_.left = fake_.right = &fake_;
+    root_ = &fake_;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_INTRUSIVE_H_
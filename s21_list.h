@@ -1,29 +1,155 @@
 #ifndef CPP2_S21_CONTAINERS_1_SRC_S21_LIST_H_
 #define CPP2_S21_CONTAINERS_1_SRC_S21_LIST_H_
 
+#include <functional>
 #include <iostream>
+#include <memory>
+
+#include "s21_alloc_stats.h"
 
 namespace s21 {
 
-template <typename T>
+// Link-level list algorithms shared by List and IntrusiveList. Node is any
+// type with prev_/next_ pointers; head and tail are the null-terminated ends.
+template <class Node>
+struct ListLinks {
+  // Detaches the chain [first, last].
+  static void Unlink(Node *&head, Node *&tail, Node *first, Node *last) {
+    Node *prev = first->prev_;
+    Node *next = last->next_;
+    if (prev != nullptr)
+      prev->next_ = next;
+    else
+      head = next;
+    if (next != nullptr)
+      next->prev_ = prev;
+    else
+      tail = prev;
+    first->prev_ = nullptr;
+    last->next_ = nullptr;
+  }
+
+  // Links the chain [first, last] in front of pos, or at the back for nullptr.
+  static void LinkBefore(Node *&head, Node *&tail, Node *pos, Node *first,
+                         Node *last) {
+    Node *prev = pos != nullptr ? pos->prev_ : tail;
+    first->prev_ = prev;
+    last->next_ = pos;
+    if (prev != nullptr)
+      prev->next_ = first;
+    else
+      head = first;
+    if (pos != nullptr)
+      pos->prev_ = last;
+    else
+      tail = last;
+  }
+
+  static void Reverse(Node *&head, Node *&tail) {
+    for (Node *node = head; node != nullptr; node = node->prev_) {
+      std::swap(node->prev_, node->next_);
+    }
+    std::swap(head, tail);
+  }
+
+  // Stable bottom-up merge sort: runs of 2^i nodes are kept in bins and only
+  // next_ links are rewritten, prev_ is restored in one final pass. less
+  // compares two nodes.
+  template <class Less>
+  static void Sort(Node *&head, Node *&tail, Less less) {
+    if (head == tail) return;
+    Node *bins[64] = {};
+    Node *node = head;
+    while (node != nullptr) {
+      Node *carry = node;
+      node = node->next_;
+      carry->next_ = nullptr;
+      int i = 0;
+      for (; bins[i] != nullptr; ++i) {
+        carry = MergeRuns(bins[i], carry, less);
+        bins[i] = nullptr;
+      }
+      bins[i] = carry;
+    }
+    Node *result = nullptr;
+    for (Node *bin : bins) {
+      if (bin != nullptr) result = result ? MergeRuns(bin, result, less) : bin;
+    }
+    head = result;
+    Node *prev = nullptr;
+    for (node = head; node != nullptr; node = node->next_) {
+      node->prev_ = prev;
+      prev = node;
+    }
+    tail = prev;
+  }
+
+  // Relinks the sorted chain other into the sorted chain head..tail in
+  // O(n + m), leaving other empty; on ties the nodes of head stay first.
+  template <class Less>
+  static void Merge(Node *&head, Node *&tail, Node *&other_head,
+                    Node *&other_tail, Less less) {
+    Node *node = head;
+    Node *source = other_head;
+    while (source != nullptr) {
+      if (node == nullptr) {
+        LinkBefore(head, tail, nullptr, source, other_tail);
+        break;
+      }
+      if (less(source, node)) {
+        Node *next = source->next_;
+        LinkBefore(head, tail, node, source, source);
+        source = next;
+      } else {
+        node = node->next_;
+      }
+    }
+    other_head = other_tail = nullptr;
+  }
+
+  // Merges two null-terminated runs by next_ only; ties keep `first` ahead.
+  template <class Less>
+  static Node *MergeRuns(Node *first, Node *second, Less &less) {
+    Node *merged = nullptr;
+    Node **link = &merged;
+    while (first != nullptr && second != nullptr) {
+      if (less(second, first)) {
+        *link = second;
+        second = second->next_;
+      } else {
+        *link = first;
+        first = first->next_;
+      }
+      link = &(*link)->next_;
+    }
+    *link = first != nullptr ? first : second;
+    return merged;
+  }
+};
+
+template <typename T,
+          class Allocator = DefaultAllocator<T, alloc_stats::ListTag>>
 class List {
  public:
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
 
+  // The list constructs and destroys val_ through the allocator, so that
+  // values taking one (e.g. pmr containers) get it too.
   class Node {
    public:
-    value_type val_;
+    union {
+      value_type val_;
+    };
     Node *prev_;
     Node *next_;
-    Node() : val_(), prev_(nullptr), next_(nullptr) {}
-    Node(const value_type value)
-        : val_(value), prev_(nullptr), next_(nullptr) {}
+    Node() : prev_(nullptr), next_(nullptr) {}
     Node(const Node &other) = delete;
     Node(const Node &&other) = delete;
-    ~Node() = default;
+    ~Node() {}
   };
 
   class ListIterator {
@@ -90,10 +216,12 @@ class List {
   iterator begin() { return iterator(head_); }
   iterator end() { return iterator(tail_->next_); }
 
-  List() {
+  List() : List(allocator_type()) {}
+
+  explicit List(const allocator_type &alloc) : alloc_(alloc) {
     size_ = 0;
     head_ = tail_ = nullptr;
-  };
+  }
 
   List(size_type n) : List() {
     for (size_type i = 0; i < n; ++i) push_back(value_type());
@@ -105,13 +233,28 @@ class List {
     }
   }
 
-  List(const List &l) : List() {
+  List(const List &l)
+      : List(l, node_traits::select_on_container_copy_construction(l.alloc_)) {
+  }
+
+  List(const List &l, const allocator_type &alloc) : List(alloc) {
     for (auto it = l.cbegin(); it != l.cend(); ++it) {
       push_back(*it);
     }
   }
 
-  List(List &&l) : List() { swap(l); }
+  List(List &&l) : List(l.get_allocator()) { swap(l); }
+
+  // Takes the nodes only when alloc can free them.
+  List(List &&l, const allocator_type &alloc) : List(alloc) {
+    if (alloc_ == l.alloc_) {
+      swap(l);
+    } else {
+      for (Node *ptr = l.head_; ptr != nullptr; ptr = ptr->next_) {
+        push_back(std::move(ptr->val_));
+      }
+    }
+  }
 
   ~List() { clear(); };
 
@@ -121,16 +264,28 @@ class List {
     }
   }
 
-  List &operator=(List &l) {
-    for (int i = 0; i < this->size_; ++i) {
-      push_back(l[i]->val_);
+  List &operator=(const List &l) {
+    if (this != &l) {
+      if constexpr (node_traits::propagate_on_container_copy_assignment::
+                        value) {
+        if (alloc_ != l.alloc_) clear();
+        alloc_ = l.alloc_;
+      }
+      List tmp(l, alloc_);
+      swap(tmp);
     }
     return *this;
   }
 
   List &operator=(List &&l) {
-    swap(l);
-    l.clear();
+    if (node_traits::propagate_on_container_move_assignment::value ||
+        alloc_ == l.alloc_) {
+      swap(l);
+      l.clear();
+    } else {
+      List tmp(std::move(l), get_allocator());
+      swap(tmp);
+    }
     return *this;
   }
 
@@ -138,14 +293,19 @@ class List {
 
   const_reference front() { return head_->val_; }
 
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
   void swap(List &other) {
     std::swap(head_, other.head_);
     std::swap(tail_, other.tail_);
     std::swap(size_, other.size_);
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
   }
 
   Node *push_front(value_type data) {
-    Node *ptr = new Node(data);
+    Node *ptr = CreateNode(data);
     ptr->next_ = head_;
     if (head_ != nullptr) {
       head_->prev_ = ptr;
@@ -159,7 +319,7 @@ class List {
   };
 
   Node *push_back(value_type data) {
-    Node *ptr = new Node(data);
+    Node *ptr = CreateNode(data);
     ptr->prev_ = tail_;
     if (tail_ != nullptr) {
       tail_->next_ = ptr;
@@ -179,7 +339,7 @@ class List {
       ptr->prev_ = nullptr;
     else
       tail_ = nullptr;
-    delete head_;
+    DestroyNode(head_);
     head_ = ptr;
     --size_;
   }
@@ -191,7 +351,7 @@ class List {
       ptr->next_ = nullptr;
     else
       head_ = nullptr;
-    delete tail_;
+    DestroyNode(tail_);
     tail_ = ptr;
     --size_;
   }
@@ -209,15 +369,7 @@ class List {
     return ptr->val_;
   }
 
-  void reverse() {
-    if (size_ < 2) return;
-    Node *ptr = head_;
-    for (int i = 0; i < size_; ++i) {
-      std::swap(ptr->prev_, ptr->next_);
-      ptr = ptr->prev_;
-    }
-    std::swap(head_, tail_);
-  };
+  void reverse() { ListLinks<Node>::Reverse(head_, tail_); }
 
   bool empty() {
     if (head_ == nullptr)
@@ -248,14 +400,14 @@ class List {
     }
   }
 
-  void sort() {
-    for (iterator it = this->begin(); it != this->end(); ++it) {
-      iterator pos = it;
-      ++pos;
-      for (; pos != this->end(); ++pos) {
-        if (*it > *pos) std::swap(*pos, *it);
-      }
-    }
+  void sort() { sort(std::less<value_type>()); }
+
+  // Stable merge sort that relinks nodes instead of moving values.
+  template <class Compare>
+  void sort(Compare comp) {
+    ListLinks<Node>::Sort(head_, tail_, [&comp](Node *a, Node *b) {
+      return comp(a->val_, b->val_);
+    });
   }
 
   iterator insert(iterator pos, const_reference value) {
@@ -267,7 +419,7 @@ class List {
       pos = tail_;
     } else {
       Node *element = pos.ptr;
-      Node *convertion = new Node(value);
+      Node *convertion = CreateNode(value);
       convertion->next_ = element;
       convertion->prev_ = element->prev_;
       element->prev_->next_ = convertion;
@@ -278,53 +430,118 @@ class List {
     return (pos);
   }
 
+  // Moves all nodes of other in front of pos in O(1); nothing is copied.
+  // As with merge, both lists must have equal allocators.
   void splice(const_iterator pos, List &other) {
-    for (iterator iter = other.begin(); iter != other.end(); ++iter) {
-      this->insert(pos, *iter);
-    }
+    if (this == &other || other.head_ == nullptr) return;
+    Node *first = other.head_;
+    Node *last = other.tail_;
+    size_type count = other.size_;
+    other.head_ = other.tail_ = nullptr;
+    other.size_ = 0;
+    LinkBefore(pos.ptr, first, last);
+    size_ += count;
   }
 
-  void merge(List &other) {
+  void splice(const_iterator pos, List &other, const_iterator it) {
+    Node *node = it.ptr;
+    if (this == &other && (node == pos.ptr || node->next_ == pos.ptr)) return;
+    other.Unlink(node, node);
+    --other.size_;
+    LinkBefore(pos.ptr, node, node);
+    ++size_;
+  }
+
+  // Moves [first, last) in front of pos. Only the node count walk is linear,
+  // and it is skipped when the nodes stay in the same list.
+  void splice(const_iterator pos, List &other, const_iterator first,
+              const_iterator last) {
+    if (first.ptr == last.ptr) return;
+    Node *begin = first.ptr;
+    Node *end = last.ptr != nullptr ? last.ptr->prev_ : other.tail_;
     if (this != &other) {
-      iterator oit = other.begin();
-      iterator it = this->begin();
-      while (!other.empty()) {
-        if (it == this->end()) {
-          this->insert(it, *oit);
-          other.erase(oit);
-          ++oit;
-        } else if (*oit < *it) {
-          this->insert(it, *oit);
-          other.erase(oit);
-          ++oit;
-        } else {
-          ++it;
-        }
-      }
+      size_type count = 1;
+      for (Node *node = begin; node != end; node = node->next_) ++count;
+      other.size_ -= count;
+      size_ += count;
+    } else if (pos.ptr == last.ptr) {
+      return;
     }
+    other.Unlink(begin, end);
+    LinkBefore(pos.ptr, begin, end);
+  }
+
+  void merge(List &other) { merge(other, std::less<value_type>()); }
+
+  // Relinks the nodes of the sorted list other into this sorted list in
+  // O(n + m); on ties the nodes already in this list stay first.
+  template <class Compare>
+  void merge(List &other, Compare comp) {
+    if (this == &other) return;
+    ListLinks<Node>::Merge(head_, tail_, other.head_, other.tail_,
+                           [&comp](Node *a, Node *b) {
+                             return comp(a->val_, b->val_);
+                           });
+    size_ += other.size_;
+    other.size_ = 0;
   }
 
   void erase(iterator pos) {
-    std::unique_ptr<Node> ptr(pos.ptr);
-    if (ptr.get() == head_ && ptr.get() == tail_) {
+    Node *ptr = pos.ptr;
+    if (ptr == head_ && ptr == tail_) {
       head_ = tail_ = nullptr;
-    } else if (ptr.get() == head_) {
+    } else if (ptr == head_) {
       head_ = head_->next_;
       head_->prev_ = nullptr;
-    } else if (ptr.get() == tail_) {
+    } else if (ptr == tail_) {
       tail_ = tail_->prev_;
       tail_->next_ = nullptr;
     } else {
       ptr->next_->prev_ = ptr->prev_;
       ptr->prev_->next_ = ptr->next_;
     }
+    DestroyNode(ptr);
     --size_;
   }
 
  private:
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  using value_traits = std::allocator_traits<Allocator>;
+
   int size_;
   Node *head_;
   Node *tail_;
+  node_allocator alloc_;
+
+  Node *CreateNode(const_reference value) {
+    Node *ptr = node_traits::allocate(alloc_, 1);
+    ::new (static_cast<void *>(ptr)) Node;
+    try {
+      allocator_type values(alloc_);
+      value_traits::construct(values, std::addressof(ptr->val_), value);
+    } catch (...) {
+      node_traits::deallocate(alloc_, ptr, 1);
+      throw;
+    }
+    return ptr;
+  }
+
+  void DestroyNode(Node *ptr) {
+    allocator_type values(alloc_);
+    value_traits::destroy(values, std::addressof(ptr->val_));
+    ptr->~Node();
+    node_traits::deallocate(alloc_, ptr, 1);
+  }
+
+  void Unlink(Node *first, Node *last) {
+    ListLinks<Node>::Unlink(head_, tail_, first, last);
+  }
+
+  void LinkBefore(Node *pos, Node *first, Node *last) {
+    ListLinks<Node>::LinkBefore(head_, tail_, pos, first, last);
+  }
 };
 
 }  // namespace s21
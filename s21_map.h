@@ -4,25 +4,44 @@
 #include "s21_binary_tree.h"
 
 namespace s21 {
-template <class Key, class T>
-class Map : BinaryTree<std::pair<Key, T>> {
+template <class Key, class T,
+          class Allocator =
+              DefaultAllocator<std::pair<const Key, T>, alloc_stats::MapTag>>
+class Map : BinaryTree<std::pair<Key, T>, std::less<std::pair<Key, T>>,
+                       Allocator> {
+  using base_type =
+      BinaryTree<std::pair<Key, T>, std::less<std::pair<Key, T>>, Allocator>;
+  using tree_type =
+      BinaryTree<std::pair<const Key, T>, std::less<std::pair<const Key, T>>,
+                 Allocator, alloc_stats::MapTag>;
+
  public:
   using key_type = Key;
   using mapped_type = T;
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename BinaryTree<value_type>::Iterator;
-  using const_iterator = typename BinaryTree<value_type>::ConstIterator;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
 
   Map() {}
 
+  explicit Map(const allocator_type &alloc) : base_type(alloc), bt(alloc) {}
+
   Map(std::initializer_list<value_type> const &items) : bt(items) {}
 
-  Map(const Map &m) : BinaryTree<std::pair<Key, T>>(), bt(m.bt) {}
+  Map(const Map &m) : base_type(), bt(m.bt) {}
+
+  Map(const Map &m, const allocator_type &alloc)
+      : base_type(alloc), bt(m.bt, alloc) {}
 
-  Map(Map &&m) noexcept : bt(std::move(m.bt)) {}
+  Map(Map &&m) noexcept
+      : base_type(m.get_allocator()), bt(std::move(m.bt)) {}
+
+  Map(Map &&m, const allocator_type &alloc)
+      : base_type(alloc), bt(std::move(m.bt), alloc) {}
 
   ~Map() {}
 
@@ -85,7 +104,7 @@ class Map : BinaryTree<std::pair<Key, T>> {
   void swap(Map &other) { return bt.swap(other.bt); }
 
   void merge(Map &other) {
-    s21::BinaryTree<value_type> tmp;
+    tree_type tmp(get_allocator());
     iterator i = other.begin();
     while (i != other.end()) {
       if (!contains((*i).first)) {
@@ -97,26 +116,26 @@ class Map : BinaryTree<std::pair<Key, T>> {
     bt.merge(tmp);
   }
 
-  //        Map Lookup
-  bool contains(const Key &key) {
-    bool found = false;
-    iterator i = begin();
-    while (i != end() && !found) {
-      if ((*i).first == key)
-        found = true;
-      else
-        ++i;
-    }
-    return found;
+  template <class RandomIt>
+  void assign_sorted(RandomIt first, RandomIt last) {
+    bt.assign_sorted(first, last);
   }
 
+  allocator_type get_allocator() const { return bt.get_allocator(); }
+
+  //        Map Lookup
+  bool contains(const Key &key) { return FindInMap(key) != nullptr; }
+
  private:
-  BinaryTree<value_type> bt;
+  tree_type bt;
 
-  typename s21::BinaryTree<value_type>::BTNode *FindInMap(const Key &key) {
+  typename tree_type::BTNode *FindInMap(const Key &key) {
+    stats::Probe<alloc_stats::MapTag> probe(stats::Op::kFind);
     iterator i = begin();
     while (i != end()) {
-      if ((*i).first == key) {
+      probe.Visit();
+      probe.Compare();
+      if (i.get()->val.first == key) {
         return i.get();
       }
       ++i;
@@ -0,0 +1,542 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_MD_ARRAY_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_MD_ARRAY_H_
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_array.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Multi-dimensional views after std::mdspan. A layout maps an index tuple to
+// an offset in flat storage; MdSpan pairs a pointer with such a mapping and
+// owns nothing, MdArray adds Vector storage with runtime extents and Tensor
+// Array storage with extents fixed in the type.
+
+namespace md {
+
+template <size_t Rank>
+using Index = Array<size_t, Rank>;
+
+// Slice arguments for submdspan besides a plain index, which drops the
+// dimension.
+struct All {};
+inline constexpr All kAll{};
+
+// Half-open [first, last).
+struct Range {
+  size_t first;
+  size_t last;
+};
+
+template <class... I>
+constexpr Index<sizeof...(I)> MakeIndex(I... i) {
+  return Index<sizeof...(I)>{static_cast<size_t>(i)...};
+}
+
+}  // namespace md
+
+// Row-major: the last index is contiguous.
+struct LayoutRight {
+  template <size_t Rank>
+  class Mapping {
+   public:
+    static constexpr bool kStrided = true;
+
+    constexpr explicit Mapping(const md::Index<Rank> &extents)
+        : extents_(extents) {}
+
+    constexpr const md::Index<Rank> &extents() const { return extents_; }
+
+    constexpr size_t stride(size_t r) const {
+      size_t stride = 1;
+      for (size_t k = r + 1; k < Rank; ++k) stride *= extents_[k];
+      return stride;
+    }
+
+    constexpr size_t required_span_size() const {
+      return stride(0) * extents_[0];
+    }
+
+    constexpr size_t operator()(const md::Index<Rank> &index) const {
+      size_t offset = 0;
+      for (size_t r = 0; r < Rank; ++r) {
+        offset = offset * extents_[r] + index[r];
+      }
+      return offset;
+    }
+
+   private:
+    md::Index<Rank> extents_;
+  };
+};
+
+// Column-major: the first index is contiguous.
+struct LayoutLeft {
+  template <size_t Rank>
+  class Mapping {
+   public:
+    static constexpr bool kStrided = true;
+
+    constexpr explicit Mapping(const md::Index<Rank> &extents)
+        : extents_(extents) {}
+
+    constexpr const md::Index<Rank> &extents() const { return extents_; }
+
+    constexpr size_t stride(size_t r) const {
+      size_t stride = 1;
+      for (size_t k = 0; k < r; ++k) stride *= extents_[k];
+      return stride;
+    }
+
+    constexpr size_t required_span_size() const {
+      return stride(Rank - 1) * extents_[Rank - 1];
+    }
+
+    constexpr size_t operator()(const md::Index<Rank> &index) const {
+      size_t offset = 0;
+      for (size_t r = Rank; r-- > 0;) {
+        offset = offset * extents_[r] + index[r];
+      }
+      return offset;
+    }
+
+   private:
+    md::Index<Rank> extents_;
+  };
+};
+
+// Arbitrary strides, as produced by submdspan.
+struct LayoutStride {
+  template <size_t Rank>
+  class Mapping {
+   public:
+    static constexpr bool kStrided = true;
+
+    constexpr Mapping(const md::Index<Rank> &extents,
+                      const md::Index<Rank> &strides)
+        : extents_(extents), strides_(strides) {}
+
+    constexpr const md::Index<Rank> &extents() const { return extents_; }
+
+    constexpr size_t stride(size_t r) const { return strides_[r]; }
+
+    constexpr size_t required_span_size() const {
+      size_t last = 0;
+      for (size_t r = 0; r < Rank; ++r) {
+        if (extents_[r] == 0) return 0;
+        last += (extents_[r] - 1) * strides_[r];
+      }
+      return last + 1;
+    }
+
+    constexpr size_t operator()(const md::Index<Rank> &index) const {
+      size_t offset = 0;
+      for (size_t r = 0; r < Rank; ++r) offset += index[r] * strides_[r];
+      return offset;
+    }
+
+   private:
+    md::Index<Rank> extents_;
+    md::Index<Rank> strides_;
+  };
+};
+
+// Matrix stored as TileRows x TileCols tiles, tiles in row-major order and
+// each tile row-major inside, so a tile is one contiguous block that stays
+// in cache while a blocked kernel works on it. Edge tiles are padded to full
+// size.
+template <size_t TileRows, size_t TileCols>
+struct LayoutTiled {
+  static constexpr size_t kTileSize = TileRows * TileCols;
+
+  template <size_t Rank>
+  class Mapping {
+    static_assert(Rank == 2, "s21::LayoutTiled is for matrices");
+
+   public:
+    static constexpr bool kStrided = false;
+
+    constexpr explicit Mapping(const md::Index<2> &extents)
+        : extents_(extents),
+          tiles_per_row_((extents[1] + TileCols - 1) / TileCols) {}
+
+    constexpr const md::Index<2> &extents() const { return extents_; }
+
+    constexpr size_t tile_rows() const {
+      return (extents_[0] + TileRows - 1) / TileRows;
+    }
+
+    constexpr size_t tile_cols() const { return tiles_per_row_; }
+
+    constexpr size_t required_span_size() const {
+      return tile_rows() * tiles_per_row_ * kTileSize;
+    }
+
+    constexpr size_t operator()(const md::Index<2> &index) const {
+      size_t tile = index[0] / TileRows * tiles_per_row_ + index[1] / TileCols;
+      return tile * kTileSize + index[0] % TileRows * TileCols +
+             index[1] % TileCols;
+    }
+
+   private:
+    md::Index<2> extents_;
+    size_t tiles_per_row_;
+  };
+};
+
+// Random-access iterator over every stride-th element. It keeps the base
+// pointer and a position, so end() never forms a pointer past the storage.
+template <class T>
+class StridedIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_cv_t<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  StridedIterator() = default;
+
+  StridedIterator(T *base, difference_type index, difference_type stride)
+      : base_(base), index_(index), stride_(stride) {}
+
+  reference operator*() const { return base_[index_ * stride_]; }
+
+  pointer operator->() const { return base_ + index_ * stride_; }
+
+  reference operator[](difference_type n) const {
+    return base_[(index_ + n) * stride_];
+  }
+
+  StridedIterator &operator++() {
+    ++index_;
+    return *this;
+  }
+
+  StridedIterator operator++(int) {
+    StridedIterator tmp = *this;
+    ++index_;
+    return tmp;
+  }
+
+  StridedIterator &operator--() {
+    --index_;
+    return *this;
+  }
+
+  StridedIterator operator--(int) {
+    StridedIterator tmp = *this;
+    --index_;
+    return tmp;
+  }
+
+  StridedIterator &operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+
+  StridedIterator &operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+  }
+
+  StridedIterator operator+(difference_type n) const {
+    return StridedIterator(base_, index_ + n, stride_);
+  }
+
+  friend StridedIterator operator+(difference_type n,
+                                   const StridedIterator &it) {
+    return it + n;
+  }
+
+  StridedIterator operator-(difference_type n) const {
+    return StridedIterator(base_, index_ - n, stride_);
+  }
+
+  difference_type operator-(const StridedIterator &other) const {
+    return index_ - other.index_;
+  }
+
+  bool operator==(const StridedIterator &other) const {
+    return index_ == other.index_;
+  }
+
+  bool operator!=(const StridedIterator &other) const {
+    return index_ != other.index_;
+  }
+
+  bool operator<(const StridedIterator &other) const {
+    return index_ < other.index_;
+  }
+
+  bool operator>(const StridedIterator &other) const {
+    return index_ > other.index_;
+  }
+
+  bool operator<=(const StridedIterator &other) const {
+    return index_ <= other.index_;
+  }
+
+  bool operator>=(const StridedIterator &other) const {
+    return index_ >= other.index_;
+  }
+
+ private:
+  T *base_ = nullptr;
+  difference_type index_ = 0;
+  difference_type stride_ = 1;
+};
+
+template <class T, size_t Rank, class Layout = LayoutRight>
+class MdSpan {
+  static_assert(Rank >= 1, "s21::MdSpan needs at least one dimension");
+
+ public:
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using pointer = T *;
+  using size_type = size_t;
+  using layout_type = Layout;
+  using mapping_type = typename Layout::template Mapping<Rank>;
+  using iterator = StridedIterator<T>;
+
+  constexpr MdSpan(pointer data, const mapping_type &mapping)
+      : data_(data), mapping_(mapping) {}
+
+  template <class... Extents,
+            class = std::enable_if_t<sizeof...(Extents) == Rank &&
+                                     (std::is_integral_v<Extents> && ...)>>
+  constexpr MdSpan(pointer data, Extents... extents)
+      : MdSpan(data, mapping_type(md::MakeIndex(extents...))) {}
+
+  static constexpr size_type rank() { return Rank; }
+
+  constexpr size_type extent(size_type r) const {
+    return mapping_.extents()[r];
+  }
+
+  constexpr size_type size() const {
+    size_type size = 1;
+    for (size_type r = 0; r < Rank; ++r) size *= extent(r);
+    return size;
+  }
+
+  constexpr bool empty() const { return size() == 0; }
+
+  constexpr size_type stride(size_type r) const { return mapping_.stride(r); }
+
+  constexpr pointer data() const { return data_; }
+
+  constexpr const mapping_type &mapping() const { return mapping_; }
+
+  template <class... I>
+  constexpr reference operator()(I... i) const {
+    static_assert(sizeof...(I) == Rank, "s21::MdSpan: wrong index count");
+    return data_[mapping_(md::MakeIndex(i...))];
+  }
+
+  template <class... I>
+  constexpr reference at(I... i) const {
+    static_assert(sizeof...(I) == Rank, "s21::MdSpan: wrong index count");
+    md::Index<Rank> index = md::MakeIndex(i...);
+    for (size_type r = 0; r < Rank; ++r) {
+      if (index[r] >= extent(r)) throw std::out_of_range("s21::MdSpan::at");
+    }
+    return data_[mapping_(index)];
+  }
+
+  // Strided iteration over a one-dimensional view, e.g. a row or column
+  // taken with submdspan.
+  iterator begin() const {
+    static_assert(Rank == 1 && mapping_type::kStrided,
+                  "s21::MdSpan::begin needs a strided rank-1 view");
+    return iterator(data_, 0, static_cast<std::ptrdiff_t>(stride(0)));
+  }
+
+  iterator end() const {
+    return begin() + static_cast<std::ptrdiff_t>(extent(0));
+  }
+
+ private:
+  pointer data_;
+  mapping_type mapping_;
+};
+
+namespace md {
+
+template <class Slice>
+inline constexpr bool kKeepsDimension = !std::is_integral_v<Slice>;
+
+}  // namespace md
+
+// Zero-copy slice of a strided view. Each argument is an index, which
+// drops that dimension, md::kAll, or an md::Range; the result keeps the
+// strides of the source.
+template <class T, size_t Rank, class Layout, class... Slices>
+auto submdspan(const MdSpan<T, Rank, Layout> &span, Slices... slices) {
+  static_assert(sizeof...(Slices) == Rank, "s21::submdspan: wrong slice count");
+  static_assert(MdSpan<T, Rank, Layout>::mapping_type::kStrided,
+                "s21::submdspan needs a strided layout");
+  constexpr size_t kNewRank = (0 + ... + md::kKeepsDimension<Slices>);
+  static_assert(kNewRank >= 1,
+                "s21::submdspan: use operator() for a single element");
+
+  md::Index<kNewRank> extents{};
+  md::Index<kNewRank> strides{};
+  size_t offset = 0, r = 0, k = 0;
+  auto apply = [&](auto slice) {
+    using Slice = decltype(slice);
+    size_t extent = span.extent(r), stride = span.stride(r);
+    if constexpr (std::is_integral_v<Slice>) {
+      if (static_cast<size_t>(slice) >= extent) {
+        throw std::out_of_range("s21::submdspan: index out of range");
+      }
+      offset += slice * stride;
+    } else if constexpr (std::is_same_v<Slice, md::All>) {
+      extents[k] = extent;
+      strides[k++] = stride;
+    } else {
+      if (slice.first > slice.last || slice.last > extent) {
+        throw std::out_of_range("s21::submdspan: range out of range");
+      }
+      offset += slice.first * stride;
+      extents[k] = slice.last - slice.first;
+      strides[k++] = stride;
+    }
+    ++r;
+  };
+  (apply(slices), ...);
+  return MdSpan<T, kNewRank, LayoutStride>(
+      span.data() + offset,
+      typename LayoutStride::template Mapping<kNewRank>(extents, strides));
+}
+
+// One tile of a tiled matrix as a contiguous row-major view.
+template <class T, size_t TileRows, size_t TileCols>
+MdSpan<T, 2> tile(const MdSpan<T, 2, LayoutTiled<TileRows, TileCols>> &span,
+                  size_t tile_row, size_t tile_col) {
+  if (tile_row >= span.mapping().tile_rows() ||
+      tile_col >= span.mapping().tile_cols()) {
+    throw std::out_of_range("s21::tile: tile out of range");
+  }
+  return MdSpan<T, 2>(span.data() + span.mapping()(md::MakeIndex(
+                                        tile_row * TileRows,
+                                        tile_col * TileCols)),
+                      TileRows, TileCols);
+}
+
+// Owning array with runtime extents, stored in a Vector.
+template <class T, size_t Rank, class Layout = LayoutRight>
+class MdArray {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using mapping_type = typename Layout::template Mapping<Rank>;
+  using view_type = MdSpan<T, Rank, Layout>;
+  using const_view_type = MdSpan<const T, Rank, Layout>;
+
+  template <class... Extents,
+            class = std::enable_if_t<sizeof...(Extents) == Rank &&
+                                     (std::is_integral_v<Extents> && ...)>>
+  explicit MdArray(Extents... extents)
+      : mapping_(md::MakeIndex(extents...)),
+        data_(mapping_.required_span_size()) {}
+
+  template <class... I>
+  reference operator()(I... i) {
+    return view()(i...);
+  }
+
+  template <class... I>
+  const_reference operator()(I... i) const {
+    return view()(i...);
+  }
+
+  template <class... I>
+  reference at(I... i) {
+    return view().at(i...);
+  }
+
+  size_type extent(size_type r) const { return mapping_.extents()[r]; }
+
+  size_type size() const { return view().size(); }
+
+  T *data() { return data_.data(); }
+
+  const T *data() const { return data_.data(); }
+
+  view_type view() { return view_type(data_.data(), mapping_); }
+
+  const_view_type view() const {
+    return const_view_type(data_.data(), mapping_);
+  }
+
+ private:
+  mapping_type mapping_;
+  Vector<T> data_;
+};
+
+// Owning array with extents fixed in the type, stored inline in an Array;
+// usable in constant expressions.
+template <class T, class Layout, size_t... Extents>
+class BasicTensor {
+ public:
+  static constexpr size_t kRank = sizeof...(Extents);
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using mapping_type = typename Layout::template Mapping<kRank>;
+  using view_type = MdSpan<T, kRank, Layout>;
+  using const_view_type = MdSpan<const T, kRank, Layout>;
+
+  static constexpr mapping_type kMapping =
+      mapping_type(md::Index<kRank>{Extents...});
+
+  constexpr BasicTensor() : data_() {}
+
+  template <class... I>
+  constexpr reference operator()(I... i) {
+    static_assert(sizeof...(I) == kRank, "s21::Tensor: wrong index count");
+    return data_[kMapping(md::MakeIndex(i...))];
+  }
+
+  template <class... I>
+  constexpr const_reference operator()(I... i) const {
+    static_assert(sizeof...(I) == kRank, "s21::Tensor: wrong index count");
+    return data_[kMapping(md::MakeIndex(i...))];
+  }
+
+  static constexpr size_type extent(size_type r) {
+    return kMapping.extents()[r];
+  }
+
+  static constexpr size_type size() { return (size_type(1) * ... * Extents); }
+
+  constexpr T *data() { return data_.data(); }
+
+  constexpr const T *data() const { return data_.data(); }
+
+  view_type view() { return view_type(data_.data(), kMapping); }
+
+  const_view_type view() const {
+    return const_view_type(data_.data(), kMapping);
+  }
+
+ private:
+  Array<T, kMapping.required_span_size()> data_;
+};
+
+template <class T, size_t... Extents>
+using Tensor = BasicTensor<T, LayoutRight, Extents...>;
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_MD_ARRAY_H_
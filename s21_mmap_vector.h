@@ -0,0 +1,319 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_MMAP_VECTOR_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_MMAP_VECTOR_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace s21 {
+
+// Vector whose storage is a shared mapping of a file. The file holds the raw
+// records and nothing else, so existing dumps can be opened as they are.
+// Growing pads the file out to the capacity; sync() and close() cut it back
+// to the stored records, so another reader sees exactly size() records.
+template <typename T>
+class MmapVector {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "s21::MmapVector requires a trivially copyable type");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  enum class Advice { kNormal, kSequential, kRandom, kWillNeed, kDontNeed };
+
+  MmapVector()
+      : array(nullptr),
+        size_(0),
+        capacity_(0),
+        file_size_(0),
+        fd_(-1),
+        readonly_(false) {}
+
+  // Opens (or creates) the file for reading and writing.
+  explicit MmapVector(const std::string &path) : MmapVector() { open(path); }
+
+  MmapVector(const MmapVector &) = delete;
+
+  MmapVector(MmapVector &&v) noexcept : MmapVector() { swap(v); }
+
+  ~MmapVector() { close(); }
+
+  MmapVector &operator=(const MmapVector &) = delete;
+
+  MmapVector &operator=(MmapVector &&v) noexcept {
+    if (this != &v) {
+      close();
+      swap(v);
+    }
+    return *this;
+  }
+
+  // Maps an existing file without copying it; pages are faulted in on demand.
+  // The mapping is private: the file is never written, and stores through
+  // operator[], at() or data() only change this process's copy of a page.
+  // Throws, like open(), when the file size is not a whole number of records.
+  static MmapVector open_readonly(const std::string &path) {
+    MmapVector v;
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) ThrowErrno("s21::MmapVector::open_readonly");
+    size_type bytes = RecordBytes(fd, "s21::MmapVector::open_readonly");
+    v.readonly_ = true;
+    v.size_ = v.capacity_ = bytes / sizeof(value_type);
+    if (v.capacity_ != 0) {
+      void *addr = ::mmap(nullptr, v.capacity_ * sizeof(value_type),
+                          PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+      if (addr == MAP_FAILED) {
+        ::close(fd);
+        ThrowErrno("s21::MmapVector::open_readonly");
+      }
+      v.array = static_cast<value_type *>(addr);
+    }
+    ::close(fd);
+    return v;
+  }
+
+  // Throws, leaving the file as it was, when its size is not a whole number
+  // of records.
+  void open(const std::string &path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) ThrowErrno("s21::MmapVector::open");
+    size_type bytes = RecordBytes(fd, "s21::MmapVector::open");
+    fd_ = fd;
+    size_ = file_size_ = bytes / sizeof(value_type);
+    Remap(size_);
+  }
+
+  // Cuts the file back to the stored records and releases the mapping.
+  void close() {
+    if (array) ::munmap(array, capacity_ * sizeof(value_type));
+    if (fd_ >= 0) {
+      if (::ftruncate(fd_, size_ * sizeof(value_type)) != 0) {
+        // nothing sensible to do from a destructor
+      }
+      ::close(fd_);
+    }
+    array = nullptr;
+    size_ = capacity_ = file_size_ = 0;
+    fd_ = -1;
+    readonly_ = false;
+  }
+
+  bool is_open() const { return fd_ >= 0 || readonly_; }
+
+  bool is_readonly() const { return readonly_; }
+
+  reference at(size_type pos) {
+    return (pos >= size_) ? throw std::out_of_range("Invalid index")
+                          : array[pos];
+  }
+
+  reference operator[](size_type pos) { return array[pos]; }
+
+  const_reference operator[](size_type pos) const { return array[pos]; }
+
+  const_reference front() {
+    return empty() ? throw std::out_of_range("Out of range") : array[0];
+  }
+
+  const_reference back() {
+    return empty() ? throw std::out_of_range("Out of range")
+                   : array[size_ - 1];
+  }
+
+  value_type *data() { return array; }
+
+  iterator begin() noexcept { return array; }
+
+  iterator end() noexcept { return array + size_; }
+
+  const_iterator begin() const noexcept { return array; }
+
+  const_iterator end() const noexcept { return array + size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type capacity() const { return capacity_; }
+
+  size_type max_size() const {
+    return std::numeric_limits<off_t>::max() / sizeof(value_type);
+  }
+
+  // Grows the file with ftruncate and maps the new length.
+  void reserve(size_type size) {
+    if (size <= capacity_) return;
+    CheckWritable();
+    Remap(size);
+  }
+
+  void shrink_to_fit() {
+    if (size_ == capacity_) return;
+    CheckWritable();
+    Remap(size_);
+  }
+
+  void resize(size_type count) {
+    CheckWritable();
+    reserve(count);
+    if (count > file_size_) GrowFile();
+    for (size_type i = size_; i < count; ++i) array[i] = value_type();
+    size_ = count;
+  }
+
+  void clear() {
+    CheckWritable();
+    size_ = 0;
+  }
+
+  void push_back(const_reference value) {
+    CheckWritable();
+    if (size_ == capacity_) reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+    if (size_ == file_size_) GrowFile();
+    array[size_++] = value;
+  }
+
+  void pop_back() {
+    CheckWritable();
+    if (size_ > 0) --size_;
+  }
+
+  // Cuts the file back to the stored records and flushes them, blocking
+  // until they and the new length are on disk unless async is set. The next
+  // push_back pads the file out to the capacity again.
+  void sync(bool async = false) {
+    if (fd_ < 0) return;
+    if (file_size_ != size_) {
+      if (::ftruncate(fd_, size_ * sizeof(value_type)) != 0) {
+        ThrowErrno("s21::MmapVector::ftruncate");
+      }
+      file_size_ = size_;
+    }
+    if (size_ != 0 && ::msync(array, size_ * sizeof(value_type),
+                              async ? MS_ASYNC : MS_SYNC) != 0) {
+      ThrowErrno("s21::MmapVector::sync");
+    }
+    if (!async && ::fsync(fd_) != 0) ThrowErrno("s21::MmapVector::fsync");
+  }
+
+  void advise(Advice advice) {
+    if (array == nullptr) return;
+    if (::posix_madvise(array, capacity_ * sizeof(value_type),
+                        ToMadvise(advice)) != 0) {
+      ThrowErrno("s21::MmapVector::advise");
+    }
+  }
+
+  void swap(MmapVector &other) noexcept {
+    std::swap(array, other.array);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(file_size_, other.file_size_);
+    std::swap(fd_, other.fd_);
+    std::swap(readonly_, other.readonly_);
+  }
+
+ private:
+  value_type *array;
+  size_type size_;
+  size_type capacity_;
+  // Records the file holds: size_ after open() and sync(), capacity_ once
+  // the vector has grown past that. Slots beyond it must not be touched.
+  size_type file_size_;
+  int fd_;
+  bool readonly_;
+
+  [[noreturn]] static void ThrowErrno(const char *what) {
+    throw std::system_error(errno, std::generic_category(), what);
+  }
+
+  static size_type FileSize(int fd) {
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      ThrowErrno("s21::MmapVector::fstat");
+    }
+    return static_cast<size_type>(st.st_size);
+  }
+
+  // Size of the file behind fd; closes fd and throws when it ends in a
+  // partial record.
+  static size_type RecordBytes(int fd, const char *what) {
+    size_type bytes = FileSize(fd);
+    if (bytes % sizeof(value_type) != 0) {
+      ::close(fd);
+      throw std::runtime_error(
+          std::string(what) +
+          ": file size is not a multiple of the record size");
+    }
+    return bytes;
+  }
+
+  static int ToMadvise(Advice advice) {
+    switch (advice) {
+      case Advice::kSequential:
+        return POSIX_MADV_SEQUENTIAL;
+      case Advice::kRandom:
+        return POSIX_MADV_RANDOM;
+      case Advice::kWillNeed:
+        return POSIX_MADV_WILLNEED;
+      case Advice::kDontNeed:
+        return POSIX_MADV_DONTNEED;
+      default:
+        return POSIX_MADV_NORMAL;
+    }
+  }
+
+  void CheckWritable() {
+    if (fd_ < 0) throw std::logic_error("s21::MmapVector::not writable");
+  }
+
+  void GrowFile() {
+    if (::ftruncate(fd_, capacity_ * sizeof(value_type)) != 0) {
+      ThrowErrno("s21::MmapVector::ftruncate");
+    }
+    file_size_ = capacity_;
+  }
+
+  // Maps the new length before resizing the file, so that a failed mmap
+  // leaves the old mapping and the file as they were; cutting the file first
+  // would leave the old mapping reaching past its end, where access raises
+  // SIGBUS.
+  void Remap(size_type capacity) {
+    value_type *mapped = nullptr;
+    if (capacity != 0) {
+      void *addr = ::mmap(nullptr, capacity * sizeof(value_type),
+                          PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+      if (addr == MAP_FAILED) ThrowErrno("s21::MmapVector::mmap");
+      mapped = static_cast<value_type *>(addr);
+    }
+    if (::ftruncate(fd_, capacity * sizeof(value_type)) != 0) {
+      int error = errno;
+      if (mapped) ::munmap(mapped, capacity * sizeof(value_type));
+      errno = error;
+      ThrowErrno("s21::MmapVector::ftruncate");
+    }
+    if (array) ::munmap(array, capacity_ * sizeof(value_type));
+    array = mapped;
+    capacity_ = file_size_ = capacity;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_MMAP_VECTOR_H_
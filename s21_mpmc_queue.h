@@ -0,0 +1,252 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_MPMC_QUEUE_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_alloc_stats.h"
+#include "s21_node_pool.h"
+
+namespace s21 {
+
+// Bounded lock-free queue for any number of producers and consumers, after
+// Dmitry Vyukov's design. Every cell carries a sequence number that says
+// whose turn it is: a producer may fill cell i of lap k once it reads
+// i + k * capacity, a consumer may empty it once it reads one more. Each
+// operation is a single CAS on the shared position plus one release store on
+// the cell, and neither side ever waits for the other.
+template <class T,
+          class Allocator = DefaultAllocator<T, alloc_stats::MpmcQueueTag>>
+class MpmcQueue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "s21::MpmcQueue needs noexcept move");
+
+  // The capacity is rounded up to a power of two, and to at least 2.
+  explicit MpmcQueue(size_type capacity,
+                     const allocator_type &alloc = allocator_type())
+      : alloc_(alloc) {
+    if (capacity == 0) {
+      throw std::length_error("s21::MpmcQueue::capacity must be positive");
+    }
+    size_type rounded = 2;
+    while (rounded < capacity) rounded <<= 1;
+    mask_ = rounded - 1;
+    cells_ = cell_traits::allocate(alloc_, rounded);
+    for (size_type i = 0; i < rounded; ++i) {
+      cell_traits::construct(alloc_, cells_ + i, i);
+    }
+  }
+
+  MpmcQueue(const MpmcQueue &) = delete;
+
+  MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+  ~MpmcQueue() {
+    size_type head = dequeue_pos_.load(std::memory_order_relaxed);
+    size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+    for (; head != tail; ++head) cells_[head & mask_].value()->~T();
+    for (size_type i = 0; i < capacity(); ++i) {
+      cell_traits::destroy(alloc_, cells_ + i);
+    }
+    cell_traits::deallocate(alloc_, cells_, capacity());
+  }
+
+  size_type capacity() const { return mask_ + 1; }
+
+  // A snapshot; exact only while no operation is in flight.
+  size_type size() const {
+    size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+    size_type head = dequeue_pos_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  // A claimed cell must be filled, so a value whose constructor may throw
+  // is built before claiming one and then moved in.
+  template <class... Args>
+  bool try_emplace(Args &&...args) {
+    if constexpr (!std::is_nothrow_constructible_v<T, Args &&...>) {
+      return try_emplace(T(std::forward<Args>(args)...));
+    }
+    size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = cells_ + (pos & mask_);
+      size_type seq = cell->sequence.load(std::memory_order_acquire);
+      std::intptr_t diff =
+          static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    ::new (static_cast<void *>(cell->storage)) T(std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool try_pop(reference out) {
+    size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = cells_ + (pos & mask_);
+      size_type seq = cell->sequence.load(std::memory_order_acquire);
+      std::intptr_t diff = static_cast<std::intptr_t>(seq) -
+                           static_cast<std::intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    T *value = cell->value();
+    out = std::move(*value);
+    value->~T();
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  struct Cell {
+    explicit Cell(size_type seq) : sequence(seq) {}
+
+    T *value() { return reinterpret_cast<T *>(storage); }
+
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  using cell_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Cell>;
+  using cell_traits = std::allocator_traits<cell_allocator>;
+
+  // Read-only after construction.
+  alignas(kCacheLineSize) Cell *cells_;
+  size_type mask_;
+  cell_allocator alloc_;
+
+  alignas(kCacheLineSize) std::atomic<size_type> enqueue_pos_{0};
+  alignas(kCacheLineSize) std::atomic<size_type> dequeue_pos_{0};
+};
+
+// MpmcQueue with blocking push and pop for worker pools. A blocked call
+// first retries for a short spin, then parks on a condition variable; the
+// other side takes the mutex to notify only when it sees someone parked, so
+// the fast path stays lock-free.
+template <class T,
+          class Allocator = DefaultAllocator<T, alloc_stats::MpmcQueueTag>>
+class BlockingMpmcQueue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  static constexpr int kSpins = 128;
+
+  explicit BlockingMpmcQueue(size_type capacity) : queue_(capacity) {}
+
+  size_type capacity() const { return queue_.capacity(); }
+
+  size_type size() const { return queue_.size(); }
+
+  bool empty() const { return queue_.empty(); }
+
+  bool try_push(const_reference value) {
+    if (!queue_.try_push(value)) return false;
+    Wake(waiting_pop_, not_empty_);
+    return true;
+  }
+
+  bool try_pop(reference out) {
+    if (!queue_.try_pop(out)) return false;
+    Wake(waiting_push_, not_full_);
+    return true;
+  }
+
+  void push(const_reference value) {
+    Wait(waiting_push_, not_full_, [&] { return queue_.try_push(value); });
+    Wake(waiting_pop_, not_empty_);
+  }
+
+  void push(value_type &&value) {
+    Wait(waiting_push_, not_full_,
+         [&] { return queue_.try_push(std::move(value)); });
+    Wake(waiting_pop_, not_empty_);
+  }
+
+  value_type pop() {
+    value_type value;
+    Wait(waiting_pop_, not_empty_, [&] { return queue_.try_pop(value); });
+    Wake(waiting_push_, not_full_);
+    return value;
+  }
+
+ private:
+  MpmcQueue<T, Allocator> queue_;
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::atomic<int> waiting_push_{0};
+  std::atomic<int> waiting_pop_{0};
+
+  template <class Attempt>
+  void Wait(std::atomic<int> &waiting, std::condition_variable &cv,
+            Attempt attempt) {
+    for (int i = 0; i < kSpins; ++i) {
+      if (attempt()) return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      waiting.fetch_add(1, std::memory_order_acq_rel);
+      bool done = attempt();
+      if (!done) cv.wait(lock);
+      waiting.fetch_sub(1, std::memory_order_relaxed);
+      if (done || attempt()) return;
+    }
+  }
+
+  // Both sides touch the counter with a read-modify-write, so either the
+  // parked thread sees our change on its retry, or we see it parked and wake
+  // it.
+  void Wake(std::atomic<int> &waiting, std::condition_variable &cv) {
+    if (waiting.fetch_add(0, std::memory_order_acq_rel) == 0) return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    cv.notify_one();
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_MPMC_QUEUE_H_
@@ -0,0 +1,410 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_NODE_POOL_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_NODE_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace s21 {
+
+constexpr std::size_t kCacheLineSize = 64;
+
+// Slab of fixed-size slots. Memory comes in cache-line-aligned chunks that
+// double in size, freed slots go onto an intrusive free list and are handed
+// out again before any new chunk is requested. Chunks are returned only when
+// the pool is destroyed.
+template <std::size_t Size, std::size_t Align>
+class NodePool {
+ public:
+  using size_type = std::size_t;
+
+  NodePool()
+      : free_(nullptr),
+        chunks_(nullptr),
+        chunk_slots_(kFirstChunk),
+        hits_(0),
+        misses_(0) {}
+
+  NodePool(const NodePool &) = delete;
+
+  NodePool &operator=(const NodePool &) = delete;
+
+  ~NodePool() {
+    while (chunks_ != nullptr) {
+      Chunk *next = chunks_->next;
+      ::operator delete(chunks_, std::align_val_t(kChunkAlign));
+      chunks_ = next;
+    }
+  }
+
+  void *allocate() {
+    if (free_ == nullptr) {
+      Grow();
+      ++misses_;
+    } else {
+      ++hits_;
+    }
+    Slot *slot = free_;
+    free_ = slot->next;
+    return slot;
+  }
+
+  void deallocate(void *ptr) noexcept {
+    Slot *slot = static_cast<Slot *>(ptr);
+    slot->next = free_;
+    free_ = slot;
+  }
+
+  // Number of slots owned by the pool, used or free.
+  size_type capacity() const {
+    size_type total = 0;
+    for (Chunk *chunk = chunks_; chunk != nullptr; chunk = chunk->next) {
+      total += chunk->slots;
+    }
+    return total;
+  }
+
+  // Allocations served from the free list, and those that needed a new chunk.
+  size_type hits() const { return hits_; }
+  size_type misses() const { return misses_; }
+
+ private:
+  union Slot {
+    Slot *next;
+    alignas(Align) unsigned char storage[Size];
+  };
+
+  struct Chunk {
+    Chunk *next;
+    size_type slots;
+  };
+
+  static constexpr size_type kFirstChunk = 32;
+  static constexpr size_type kMaxChunk = 4096;
+  static constexpr size_type kChunkAlign =
+      alignof(Slot) > kCacheLineSize ? alignof(Slot) : kCacheLineSize;
+
+  Slot *free_;
+  Chunk *chunks_;
+  size_type chunk_slots_;
+  size_type hits_;
+  size_type misses_;
+
+  // Slots start one alignment unit after the chunk header and are pushed in
+  // reverse so consecutive allocations are adjacent in memory.
+  void Grow() {
+    size_type bytes = kChunkAlign + chunk_slots_ * sizeof(Slot);
+    void *memory = ::operator new(bytes, std::align_val_t(kChunkAlign));
+    Chunk *chunk = static_cast<Chunk *>(memory);
+    chunk->next = chunks_;
+    chunk->slots = chunk_slots_;
+    chunks_ = chunk;
+    Slot *slots =
+        reinterpret_cast<Slot *>(static_cast<char *>(memory) + kChunkAlign);
+    for (size_type i = chunk_slots_; i > 0; --i) deallocate(slots + i - 1);
+    if (chunk_slots_ < kMaxChunk) chunk_slots_ *= 2;
+  }
+};
+
+// Pools of every slot size used by one family of PoolAllocators, so that a
+// copy rebound to another type still shares memory with the original.
+class PoolSet {
+ public:
+  template <std::size_t Size, std::size_t Align>
+  NodePool<Size, Align> &get() {
+    for (auto &entry : entries_) {
+      if (entry.size == Size && entry.align == Align) {
+        return *static_cast<NodePool<Size, Align> *>(entry.pool.get());
+      }
+    }
+    auto pool = std::make_shared<NodePool<Size, Align>>();
+    entries_.push_back(Entry{Size, Align, pool});
+    return *pool;
+  }
+
+ private:
+  struct Entry {
+    std::size_t size;
+    std::size_t align;
+    std::shared_ptr<void> pool;
+  };
+
+  std::vector<Entry> entries_;
+};
+
+// Allocator with its own PoolSet; copies share it, including copies rebound
+// to another type, which take the pool for their own slot size. Single-object
+// requests come from the pool, array requests go to the global heap.
+template <class T>
+class PoolAllocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using pool_type = NodePool<sizeof(T), alignof(T)>;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  PoolAllocator()
+      : pools_(std::make_shared<PoolSet>()),
+        pool_(&pools_->get<sizeof(T), alignof(T)>()) {}
+
+  template <class U>
+  PoolAllocator(const PoolAllocator<U> &other)
+      : pools_(other.pools_), pool_(&pools_->get<sizeof(T), alignof(T)>()) {}
+
+  T *allocate(size_type n) {
+    if (n == 1) return static_cast<T *>(pool_->allocate());
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *ptr, size_type n) noexcept {
+    if (n == 1)
+      pool_->deallocate(ptr);
+    else
+      std::allocator<T>().deallocate(ptr, n);
+  }
+
+  pool_type &pool() const { return *pool_; }
+
+  friend bool operator==(const PoolAllocator &a, const PoolAllocator &b) {
+    return a.pools_ == b.pools_;
+  }
+
+  friend bool operator!=(const PoolAllocator &a, const PoolAllocator &b) {
+    return a.pools_ != b.pools_;
+  }
+
+ private:
+  template <class U>
+  friend class PoolAllocator;
+
+  std::shared_ptr<PoolSet> pools_;
+  pool_type *pool_;
+};
+
+// Slab owned by one thread whose slots may be freed on any thread. Chunks
+// have a fixed power-of-two size and the same alignment, so masking a slot's
+// address finds the chunk header and with it the owning pool. A slot freed by
+// its owner goes straight onto the free list; one freed elsewhere goes onto a
+// mutex-guarded list that the owner drains once its free list runs dry. When
+// the owner exits, the pool lives on until the last of its slots comes back.
+template <std::size_t Size, std::size_t Align>
+class ThreadNodePool {
+ public:
+  using size_type = std::size_t;
+
+  ThreadNodePool(const ThreadNodePool &) = delete;
+
+  ThreadNodePool &operator=(const ThreadNodePool &) = delete;
+
+  // Pool of the calling thread, created on first use.
+  static ThreadNodePool &local() {
+    thread_local Owner owner;
+    return *owner.pool;
+  }
+
+  void *allocate() {
+    if (free_ == nullptr && has_remote_.load(std::memory_order_acquire)) {
+      Drain();
+    }
+    if (free_ == nullptr) {
+      Grow();
+      ++misses_;
+    } else {
+      ++hits_;
+    }
+    Slot *slot = free_;
+    free_ = slot->next;
+    ++in_use_;
+    return slot;
+  }
+
+  // Returns ptr to the pool that handed it out, from whichever thread.
+  static void deallocate(void *ptr) noexcept {
+    ThreadNodePool *owner = ChunkOf(ptr)->owner;
+    if (owner == current_) {
+      owner->Push(static_cast<Slot *>(ptr));
+      --owner->in_use_;
+    } else {
+      owner->PushRemote(static_cast<Slot *>(ptr));
+    }
+  }
+
+  size_type capacity() const { return chunk_count_ * kChunkSlots; }
+  size_type hits() const { return hits_; }
+  size_type misses() const { return misses_; }
+
+ private:
+  union Slot {
+    Slot *next;
+    alignas(Align) unsigned char storage[Size];
+  };
+
+  struct Chunk {
+    ThreadNodePool *owner;
+    Chunk *next;
+  };
+
+  // Creates the thread's pool and hands it over to the remaining slots when
+  // the thread exits.
+  struct Owner {
+    ThreadNodePool *pool;
+
+    Owner() : pool(new ThreadNodePool) { current_ = pool; }
+
+    ~Owner() {
+      current_ = nullptr;
+      pool->Orphan();
+    }
+  };
+
+  static constexpr size_type kSlotOffset =
+      alignof(Slot) > kCacheLineSize ? alignof(Slot) : kCacheLineSize;
+
+  static constexpr size_type ChunkBytes() {
+    size_type bytes = size_type(1) << 14;
+    while (bytes < kSlotOffset + 32 * sizeof(Slot)) bytes *= 2;
+    return bytes;
+  }
+
+  static constexpr size_type kChunkBytes = ChunkBytes();
+  static constexpr size_type kChunkSlots =
+      (kChunkBytes - kSlotOffset) / sizeof(Slot);
+
+  static inline thread_local ThreadNodePool *current_ = nullptr;
+
+  // Owner-thread state.
+  Slot *free_ = nullptr;
+  Chunk *chunks_ = nullptr;
+  size_type chunk_count_ = 0;
+  size_type in_use_ = 0;
+  size_type hits_ = 0;
+  size_type misses_ = 0;
+
+  // Slots freed on other threads, guarded by mutex_.
+  std::mutex mutex_;
+  Slot *remote_ = nullptr;
+  size_type remote_count_ = 0;
+  bool orphaned_ = false;
+  std::atomic<bool> has_remote_{false};
+
+  ThreadNodePool() = default;
+
+  ~ThreadNodePool() {
+    while (chunks_ != nullptr) {
+      Chunk *next = chunks_->next;
+      ::operator delete(chunks_, std::align_val_t(kChunkBytes));
+      chunks_ = next;
+    }
+  }
+
+  static Chunk *ChunkOf(void *ptr) {
+    auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    return reinterpret_cast<Chunk *>(address & ~(kChunkBytes - 1));
+  }
+
+  void Push(Slot *slot) {
+    slot->next = free_;
+    free_ = slot;
+  }
+
+  void PushRemote(Slot *slot) {
+    bool last = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      slot->next = remote_;
+      remote_ = slot;
+      ++remote_count_;
+      has_remote_.store(true, std::memory_order_release);
+      last = orphaned_ && remote_count_ == in_use_;
+    }
+    if (last) delete this;
+  }
+
+  void Drain() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (remote_ != nullptr) {
+      Slot *next = remote_->next;
+      Push(remote_);
+      remote_ = next;
+    }
+    in_use_ -= remote_count_;
+    remote_count_ = 0;
+    has_remote_.store(false, std::memory_order_relaxed);
+  }
+
+  void Orphan() {
+    bool last = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      orphaned_ = true;
+      last = remote_count_ == in_use_;
+    }
+    if (last) delete this;
+  }
+
+  void Grow() {
+    void *memory = ::operator new(kChunkBytes, std::align_val_t(kChunkBytes));
+    Chunk *chunk = static_cast<Chunk *>(memory);
+    chunk->owner = this;
+    chunk->next = chunks_;
+    chunks_ = chunk;
+    ++chunk_count_;
+    Slot *slots =
+        reinterpret_cast<Slot *>(static_cast<char *>(memory) + kSlotOffset);
+    for (size_type i = kChunkSlots; i > 0; --i) Push(slots + i - 1);
+  }
+};
+
+// Stateless allocator backed by one ThreadNodePool per thread and node type.
+// Nodes may be handed to and freed on another thread: each goes back to the
+// pool of the thread that allocated it, so any instance can free memory from
+// any other.
+template <class T>
+class ThreadLocalPoolAllocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using pool_type = ThreadNodePool<sizeof(T), alignof(T)>;
+  using is_always_equal = std::true_type;
+
+  ThreadLocalPoolAllocator() = default;
+
+  template <class U>
+  ThreadLocalPoolAllocator(const ThreadLocalPoolAllocator<U> &) {}
+
+  T *allocate(size_type n) {
+    if (n == 1) return static_cast<T *>(pool().allocate());
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *ptr, size_type n) noexcept {
+    if (n == 1)
+      pool_type::deallocate(ptr);
+    else
+      std::allocator<T>().deallocate(ptr, n);
+  }
+
+  // Pool of the calling thread.
+  static pool_type &pool() { return pool_type::local(); }
+
+  friend bool operator==(const ThreadLocalPoolAllocator &,
+                         const ThreadLocalPoolAllocator &) {
+    return true;
+  }
+
+  friend bool operator!=(const ThreadLocalPoolAllocator &,
+                         const ThreadLocalPoolAllocator &) {
+    return false;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_NODE_POOL_H_
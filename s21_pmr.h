@@ -0,0 +1,53 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_PMR_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_PMR_H_
+
+#include <functional>
+#include <memory_resource>
+#include <utility>
+
+#include "s21_binary_tree.h"
+#include "s21_deque.h"
+#include "s21_list.h"
+#include "s21_map.h"
+#include "s21_set.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// The allocator-aware containers on std::pmr::polymorphic_allocator. A
+// container takes its memory_resource as the allocator argument:
+//   std::pmr::monotonic_buffer_resource arena;
+//   s21::pmr::Map<int, s21::pmr::Vector<int>> m(&arena);
+// Elements that take an allocator themselves, like the Vector above, are
+// built on the resource of their container. The resource stays with the
+// container: copies get the default one unless given another, moving to a
+// container on another resource moves the elements, and swap needs both
+// containers on the same resource.
+namespace pmr {
+
+template <class T>
+using Vector = s21::Vector<T, std::pmr::polymorphic_allocator<T>>;
+
+template <class T>
+using List = s21::List<T, std::pmr::polymorphic_allocator<T>>;
+
+template <class T>
+using Deque = s21::Deque<T, std::pmr::polymorphic_allocator<T>>;
+
+template <class K, class Compare = std::less<K>>
+using BinaryTree =
+    s21::BinaryTree<K, Compare, std::pmr::polymorphic_allocator<K>>;
+
+template <class Key>
+using Set = s21::Set<Key, BinaryTree<Key>>;
+
+template <class Key, class T>
+using Map =
+    s21::Map<Key, T,
+             std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_PMR_H_
@@ -0,0 +1,182 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_PRIORITY_QUEUE_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Heap adapter whose top is the greatest element under Compare. Each node
+// has Arity children stored next to each other, so with the default of four
+// a sift-down touches half as many levels as a binary heap and reads its
+// children from one or two cache lines.
+template <class T, class Container = Vector<T>, class Compare = std::less<T>,
+          std::size_t Arity = 4>
+class PriorityQueue {
+  static_assert(Arity >= 2, "s21::PriorityQueue needs at least two children");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using container_type = Container;
+  using value_compare = Compare;
+
+  PriorityQueue() : PriorityQueue(Compare()) {}
+
+  explicit PriorityQueue(const Compare &comp) : comp(comp) {}
+
+  PriorityQueue(std::initializer_list<value_type> const &items)
+      : PriorityQueue(items.begin(), items.end()) {}
+
+  // Builds the heap bottom-up in O(n).
+  template <class InputIt>
+  PriorityQueue(InputIt first, InputIt last, const Compare &comp = Compare())
+      : comp(comp) {
+    for (; first != last; ++first) c.push_back(*first);
+    Heapify();
+  }
+
+  PriorityQueue(const PriorityQueue &q) : c(q.c), comp(q.comp) {}
+
+  PriorityQueue(PriorityQueue &&q) : c(std::move(q.c)), comp(q.comp) {}
+
+  ~PriorityQueue() {}
+
+  PriorityQueue &operator=(PriorityQueue &&q) {
+    c = std::move(q.c);
+    comp = q.comp;
+    return *this;
+  }
+
+  const_reference top() { return *c.begin(); }
+
+  bool empty() { return c.empty(); }
+
+  size_type size() { return c.size(); }
+
+  void push(const_reference value) {
+    c.push_back(value);
+    SiftUp(c.size() - 1);
+  }
+
+  template <class... Args>
+  void emplace(Args &&...args) {
+    push(value_type(std::forward<Args>(args)...));
+  }
+
+  // Appends the range, then either sifts each new element up or rebuilds the
+  // whole heap, whichever is cheaper for the number added.
+  template <class InputIt>
+  void push_range(InputIt first, InputIt last) {
+    size_type old_size = c.size();
+    for (; first != last; ++first) c.push_back(*first);
+    size_type added = c.size() - old_size;
+    if (added > old_size / 2) {
+      Heapify();
+    } else {
+      for (size_type i = old_size; i < c.size(); ++i) SiftUp(i);
+    }
+  }
+
+  void pop() {
+    if (c.empty()) return;
+    auto first = c.begin();
+    size_type last = c.size() - 1;
+    if (last != 0) {
+      value_type value = std::move(first[last]);
+      c.pop_back();
+      SiftUp(SinkHole(0), std::move(value));
+    } else {
+      c.pop_back();
+    }
+  }
+
+  void swap(PriorityQueue &other) {
+    std::swap(c, other.c);
+    std::swap(comp, other.comp);
+  }
+
+ protected:
+  Container c;
+  Compare comp;
+
+ private:
+  void Heapify() {
+    size_type n = c.size();
+    if (n < 2) return;
+    auto first = c.begin();
+    for (size_type i = (n - 2) / Arity + 1; i-- > 0;) {
+      value_type value = std::move(first[i]);
+      SiftDown(i, std::move(value));
+    }
+  }
+
+  void SiftUp(size_type index) {
+    auto first = c.begin();
+    value_type value = std::move(first[index]);
+    SiftUp(index, std::move(value));
+  }
+
+  // Moves the hole at index up while value outranks its parent, then drops
+  // value into it.
+  void SiftUp(size_type index, value_type &&value) {
+    auto first = c.begin();
+    while (index > 0) {
+      size_type parent = (index - 1) / Arity;
+      if (!comp(first[parent], value)) break;
+      first[index] = std::move(first[parent]);
+      index = parent;
+    }
+    first[index] = std::move(value);
+  }
+
+  // Fills the hole at index with value, pulling the greatest child up while
+  // it outranks value.
+  void SiftDown(size_type index, value_type &&value) {
+    auto first = c.begin();
+    size_type n = c.size();
+    for (;;) {
+      size_type child = index * Arity + 1;
+      if (child >= n) break;
+      size_type end = child + Arity < n ? child + Arity : n;
+      size_type best = child;
+      for (++child; child < end; ++child) {
+        if (comp(first[best], first[child])) best = child;
+      }
+      if (!comp(value, first[best])) break;
+      first[index] = std::move(first[best]);
+      index = best;
+    }
+    first[index] = std::move(value);
+  }
+
+  // Pulls the greatest child into the hole at index all the way down to a
+  // leaf and returns the leaf. Popping then sifts the former last element up
+  // from there: it usually belongs near the bottom, so this saves comparing
+  // it against the children on every level.
+  size_type SinkHole(size_type index) {
+    auto first = c.begin();
+    size_type n = c.size();
+    for (;;) {
+      size_type child = index * Arity + 1;
+      if (child >= n) return index;
+      size_type end = child + Arity < n ? child + Arity : n;
+      size_type best = child;
+      for (++child; child < end; ++child) {
+        if (comp(first[best], first[child])) best = child;
+      }
+      first[index] = std::move(first[best]);
+      index = best;
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_PRIORITY_QUEUE_H_
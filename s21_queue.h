@@ -27,9 +27,11 @@ class Queue {
     return *this;
   }
 
-  const_reference front() { return c.begin(); }
+  // Writable when the container hands out writable references, so an
+  // element can be moved out before pop.
+  decltype(auto) front() { return c.front(); }
 
-  const_reference back() { return c.end(); }
+  decltype(auto) back() { return c.back(); }
 
   bool empty() { return c.empty(); }
 
@@ -37,6 +39,11 @@ class Queue {
 
   void push(const_reference value) { c.push_back(value); }
 
+  template <class... Args>
+  void emplace(Args &&...args) {
+    c.emplace_back(std::forward<Args>(args)...);
+  }
+
   void pop() { c.pop_front(); }
 
   void swap(Queue &other) { std::swap(c, other.c); }
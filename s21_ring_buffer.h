@@ -0,0 +1,430 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_RING_BUFFER_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_RING_BUFFER_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_alloc_stats.h"
+
+namespace s21 {
+
+// Contiguous circular buffer whose capacity is always a power of two, so a
+// logical index maps to a slot with one mask. It grows by doubling unless it
+// was created with a fixed capacity in overwrite mode, in which case a push
+// into a full buffer drops the element at the opposite end. Once the
+// capacity is reached, pushes and pops never allocate. Satisfies the
+// Container interface of Queue and Stack.
+template <class T,
+          class Allocator = DefaultAllocator<T, alloc_stats::RingBufferTag>>
+class RingBuffer {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  enum class Overflow { kGrow, kOverwrite };
+
+  class RingBufferIterator {
+    friend RingBuffer;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    RingBufferIterator() = default;
+
+    reference operator*() const { return buffer_->Slot(index_); }
+
+    pointer operator->() const { return &buffer_->Slot(index_); }
+
+    reference operator[](difference_type n) const {
+      return buffer_->Slot(index_ + n);
+    }
+
+    RingBufferIterator &operator++() {
+      ++index_;
+      return *this;
+    }
+
+    RingBufferIterator operator++(int) {
+      RingBufferIterator tmp = *this;
+      ++index_;
+      return tmp;
+    }
+
+    RingBufferIterator &operator--() {
+      --index_;
+      return *this;
+    }
+
+    RingBufferIterator operator--(int) {
+      RingBufferIterator tmp = *this;
+      --index_;
+      return tmp;
+    }
+
+    RingBufferIterator &operator+=(difference_type n) {
+      index_ += n;
+      return *this;
+    }
+
+    RingBufferIterator &operator-=(difference_type n) {
+      index_ -= n;
+      return *this;
+    }
+
+    RingBufferIterator operator+(difference_type n) const {
+      return RingBufferIterator(buffer_, index_ + n);
+    }
+
+    friend RingBufferIterator operator+(difference_type n,
+                                        const RingBufferIterator &it) {
+      return it + n;
+    }
+
+    RingBufferIterator operator-(difference_type n) const {
+      return RingBufferIterator(buffer_, index_ - n);
+    }
+
+    difference_type operator-(const RingBufferIterator &other) const {
+      return static_cast<difference_type>(index_) -
+             static_cast<difference_type>(other.index_);
+    }
+
+    bool operator==(const RingBufferIterator &other) const {
+      return index_ == other.index_;
+    }
+
+    bool operator!=(const RingBufferIterator &other) const {
+      return index_ != other.index_;
+    }
+
+    bool operator<(const RingBufferIterator &other) const {
+      return index_ < other.index_;
+    }
+
+    bool operator>(const RingBufferIterator &other) const {
+      return index_ > other.index_;
+    }
+
+    bool operator<=(const RingBufferIterator &other) const {
+      return index_ <= other.index_;
+    }
+
+    bool operator>=(const RingBufferIterator &other) const {
+      return index_ >= other.index_;
+    }
+
+   private:
+    RingBufferIterator(const RingBuffer *buffer, size_type index)
+        : buffer_(buffer), index_(index) {}
+
+    const RingBuffer *buffer_ = nullptr;
+    size_type index_ = 0;
+  };
+
+  class RingBufferConstIterator : public RingBufferIterator {
+   public:
+    using reference = const T &;
+    using pointer = const T *;
+
+    RingBufferConstIterator() : RingBufferIterator() {}
+    RingBufferConstIterator(const RingBufferIterator &it)
+        : RingBufferIterator(it) {}
+
+    const_reference operator*() const {
+      return RingBufferIterator::operator*();
+    }
+
+    const value_type *operator->() const {
+      return RingBufferIterator::operator->();
+    }
+
+    const_reference operator[](std::ptrdiff_t n) const {
+      return RingBufferIterator::operator[](n);
+    }
+  };
+
+  using iterator = RingBufferIterator;
+  using const_iterator = RingBufferConstIterator;
+
+  RingBuffer() : RingBuffer(allocator_type()) {}
+
+  explicit RingBuffer(const allocator_type &alloc)
+      : buf_(nullptr),
+        mask_(0),
+        head_(0),
+        size_(0),
+        overflow_(Overflow::kGrow),
+        alloc_(alloc) {}
+
+  // Reserves at least capacity slots, rounded up to a power of two. With
+  // Overflow::kOverwrite that capacity is final.
+  explicit RingBuffer(size_type capacity, Overflow overflow = Overflow::kGrow,
+                      const allocator_type &alloc = allocator_type())
+      : RingBuffer(alloc) {
+    overflow_ = overflow;
+    if (capacity == 0 && overflow == Overflow::kOverwrite) {
+      throw std::length_error("s21::RingBuffer::capacity must be positive");
+    }
+    if (capacity != 0) Reallocate(RoundUp(capacity));
+  }
+
+  RingBuffer(std::initializer_list<value_type> const &items) : RingBuffer() {
+    reserve(items.size());
+    for (const_reference item : items) push_back(item);
+  }
+
+  RingBuffer(const RingBuffer &other)
+      : RingBuffer(other, traits::select_on_container_copy_construction(
+                              other.alloc_)) {}
+
+  RingBuffer(const RingBuffer &other, const allocator_type &alloc)
+      : RingBuffer(alloc) {
+    overflow_ = other.overflow_;
+    if (other.capacity() != 0) Reallocate(other.capacity());
+    for (const_reference item : other) push_back(item);
+  }
+
+  RingBuffer(RingBuffer &&other) : RingBuffer(other.alloc_) { swap(other); }
+
+  // Takes the buffer only when alloc can free it.
+  RingBuffer(RingBuffer &&other, const allocator_type &alloc)
+      : RingBuffer(alloc) {
+    if (alloc_ == other.alloc_) {
+      swap(other);
+    } else {
+      overflow_ = other.overflow_;
+      if (other.capacity() != 0) Reallocate(other.capacity());
+      for (reference item : other) emplace_back(std::move(item));
+    }
+  }
+
+  ~RingBuffer() { Release(); }
+
+  RingBuffer &operator=(const RingBuffer &other) {
+    if (this != &other) {
+      if constexpr (traits::propagate_on_container_copy_assignment::value) {
+        if (alloc_ != other.alloc_) Release();
+        alloc_ = other.alloc_;
+      }
+      RingBuffer tmp(other, alloc_);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  RingBuffer &operator=(RingBuffer &&other) {
+    if (this != &other) {
+      if (traits::propagate_on_container_move_assignment::value ||
+          alloc_ == other.alloc_) {
+        Release();
+        if constexpr (traits::propagate_on_container_move_assignment::value) {
+          alloc_ = other.alloc_;
+        }
+        swap(other);
+      } else {
+        RingBuffer tmp(std::move(other), alloc_);
+        swap(tmp);
+      }
+    }
+    return *this;
+  }
+
+  reference operator[](size_type index) { return Slot(index); }
+  const_reference operator[](size_type index) const { return Slot(index); }
+
+  reference at(size_type index) {
+    if (index >= size_) throw std::out_of_range("s21::RingBuffer::at");
+    return Slot(index);
+  }
+
+  const_reference at(size_type index) const {
+    if (index >= size_) throw std::out_of_range("s21::RingBuffer::at");
+    return Slot(index);
+  }
+
+  reference front() { return Slot(0); }
+  const_reference front() const { return Slot(0); }
+
+  reference back() { return Slot(size_ - 1); }
+  const_reference back() const { return Slot(size_ - 1); }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, size_); }
+
+  const_iterator begin() const { return iterator(this, 0); }
+  const_iterator end() const { return iterator(this, size_); }
+
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+
+  bool full() const { return size_ == capacity(); }
+
+  size_type size() const { return size_; }
+
+  size_type capacity() const { return buf_ == nullptr ? 0 : mask_ + 1; }
+
+  size_type max_size() const { return traits::max_size(alloc_); }
+
+  Overflow overflow() const { return overflow_; }
+
+  allocator_type get_allocator() const { return alloc_; }
+
+  void reserve(size_type capacity) {
+    if (capacity > this->capacity() && overflow_ == Overflow::kGrow) {
+      Reallocate(RoundUp(capacity));
+    }
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_front(const_reference value) { emplace_front(value); }
+
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    if (full()) {
+      // Built first, as args may refer to an element about to be dropped
+      // or moved.
+      value_type value(std::forward<Args>(args)...);
+      MakeRoom(true);
+      traits::construct(alloc_, &Slot(size_), std::move(value));
+    } else {
+      traits::construct(alloc_, &Slot(size_), std::forward<Args>(args)...);
+    }
+    ++size_;
+    return back();
+  }
+
+  template <class... Args>
+  reference emplace_front(Args &&...args) {
+    if (full()) {
+      value_type value(std::forward<Args>(args)...);
+      MakeRoom(false);
+      ConstructFront(std::move(value));
+    } else {
+      ConstructFront(std::forward<Args>(args)...);
+    }
+    ++size_;
+    return front();
+  }
+
+  void pop_front() {
+    if (empty()) return;
+    traits::destroy(alloc_, buf_ + head_);
+    head_ = (head_ + 1) & mask_;
+    --size_;
+  }
+
+  void pop_back() {
+    if (empty()) return;
+    traits::destroy(alloc_, &Slot(size_ - 1));
+    --size_;
+  }
+
+  void clear() {
+    while (!empty()) pop_back();
+    head_ = 0;
+  }
+
+  void swap(RingBuffer &other) {
+    std::swap(buf_, other.buf_);
+    std::swap(mask_, other.mask_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    std::swap(overflow_, other.overflow_);
+    if constexpr (traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+  }
+
+ private:
+  using traits = std::allocator_traits<Allocator>;
+
+  static constexpr size_type kMinCapacity = 8;
+
+  T *buf_;
+  size_type mask_;
+  // Slot of the front element.
+  size_type head_;
+  size_type size_;
+  Overflow overflow_;
+  allocator_type alloc_;
+
+  reference Slot(size_type index) const {
+    return buf_[(head_ + index) & mask_];
+  }
+
+  template <class... Args>
+  void ConstructFront(Args &&...args) {
+    size_type head = (head_ - 1) & mask_;
+    traits::construct(alloc_, buf_ + head, std::forward<Args>(args)...);
+    head_ = head;
+  }
+
+  // Frees the elements and the buffer.
+  void Release() {
+    clear();
+    if (buf_ != nullptr) traits::deallocate(alloc_, buf_, capacity());
+    buf_ = nullptr;
+    mask_ = 0;
+  }
+
+  static size_type RoundUp(size_type capacity) {
+    size_type result = 1;
+    while (result < capacity) result <<= 1;
+    return result;
+  }
+
+  // Called on a full buffer: doubles it, or in overwrite mode drops the
+  // element at the end opposite to the push.
+  void MakeRoom(bool at_back) {
+    if (overflow_ == Overflow::kOverwrite) {
+      if (at_back)
+        pop_front();
+      else
+        pop_back();
+    } else {
+      Reallocate(capacity() == 0 ? kMinCapacity : capacity() * 2);
+    }
+  }
+
+  // Moves the elements to a new buffer of the given power-of-two capacity,
+  // unwrapped so the front lands in slot 0.
+  void Reallocate(size_type capacity) {
+    T *buf = traits::allocate(alloc_, capacity);
+    size_type moved = 0;
+    try {
+      for (; moved < size_; ++moved) {
+        traits::construct(alloc_, buf + moved,
+                          std::move_if_noexcept(Slot(moved)));
+      }
+    } catch (...) {
+      while (moved > 0) traits::destroy(alloc_, buf + --moved);
+      traits::deallocate(alloc_, buf, capacity);
+      throw;
+    }
+    if (buf_ != nullptr) {
+      for (size_type i = 0; i < size_; ++i) traits::destroy(alloc_, &Slot(i));
+      traits::deallocate(alloc_, buf_, this->capacity());
+    }
+    buf_ = buf;
+    mask_ = capacity - 1;
+    head_ = 0;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_RING_BUFFER_H_
@@ -0,0 +1,518 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_SERIALIZE_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_SERIALIZE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_array.h"
+#include "s21_deque.h"
+#include "s21_list.h"
+#include "s21_map.h"
+#include "s21_set.h"
+#include "s21_vector.h"
+
+// Binary format (native byte order):
+//   header: "S21C" | u16 version | u16 flags | u32 value size | u64 count
+//   chunks: u64 element count | u64 byte length | payload, ending with an
+//           empty chunk.
+// The count is kStreamed when the writer did not know it up front. Every
+// length read back is checked against the bytes that actually arrive before
+// anything of that size is allocated, so a corrupt file fails with
+// std::runtime_error rather than std::bad_alloc.
+namespace s21 {
+namespace serialization {
+
+constexpr char kMagic[4] = {'S', '2', '1', 'C'};
+constexpr std::uint16_t kVersion = 1;
+constexpr std::uint64_t kStreamed = std::numeric_limits<std::uint64_t>::max();
+constexpr std::uint16_t kRawFlag = 1;
+constexpr std::uint16_t kChunkedFlag = 2;
+// Payloads are read in pieces that start at kReadStep bytes and double, so
+// memory grows with the data received rather than with the length claimed.
+constexpr std::size_t kReadStep = 1 << 16;
+// Most elements reserved up front from an unchecked header count.
+constexpr std::uint64_t kReserveLimit = 1 << 16;
+
+struct Header {
+  std::uint16_t version;
+  std::uint16_t flags;
+  std::uint32_t value_size;
+  std::uint64_t count;
+};
+
+class Cursor {
+ public:
+  Cursor(const char *begin, const char *end) : pos_(begin), end_(end) {}
+
+  size_t Remaining() const { return static_cast<size_t>(end_ - pos_); }
+
+  void Take(void *dst, size_t n) {
+    if (Remaining() < n) {
+      throw std::runtime_error("s21::deserialize::truncated payload");
+    }
+    std::memcpy(dst, pos_, n);
+    pos_ += n;
+  }
+
+ private:
+  const char *pos_;
+  const char *end_;
+};
+
+template <class T>
+struct IsPair : std::false_type {};
+
+template <class A, class B>
+struct IsPair<std::pair<A, B>> : std::true_type {};
+
+// Codec<T>::kRaw marks payloads whose bytes can be written as they are;
+// kSize is the encoded size of one value, or 0 when it varies, and kMinSize
+// the fewest bytes any value encodes to.
+template <class T, class Enable = void>
+struct Codec {
+  static_assert(sizeof(T) == 0, "s21::serialize::no codec for this type");
+};
+
+template <class T>
+struct Codec<T, std::enable_if_t<std::is_trivially_copyable<T>::value &&
+                                  !IsPair<T>::value>> {
+  static constexpr bool kRaw = true;
+  static constexpr std::uint32_t kSize = sizeof(T);
+  static constexpr std::uint32_t kMinSize = sizeof(T);
+
+  static void Put(std::string &buf, const T &value) {
+    buf.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  static T Get(Cursor &cursor) {
+    T value;
+    cursor.Take(&value, sizeof(T));
+    return value;
+  }
+};
+
+template <class C>
+struct Codec<std::basic_string<C>> {
+  static constexpr bool kRaw = false;
+  static constexpr std::uint32_t kSize = 0;
+  static constexpr std::uint32_t kMinSize = sizeof(std::uint64_t);
+
+  static void Put(std::string &buf, const std::basic_string<C> &value) {
+    Codec<std::uint64_t>::Put(buf, value.size());
+    buf.append(reinterpret_cast<const char *>(value.data()),
+               value.size() * sizeof(C));
+  }
+
+  static std::basic_string<C> Get(Cursor &cursor) {
+    std::uint64_t length = Codec<std::uint64_t>::Get(cursor);
+    if (length > cursor.Remaining() / sizeof(C)) {
+      throw std::runtime_error("s21::deserialize::corrupt string length");
+    }
+    std::basic_string<C> value(length, C());
+    cursor.Take(&value[0], value.size() * sizeof(C));
+    return value;
+  }
+};
+
+template <class A, class B>
+struct Codec<std::pair<A, B>> {
+  using first_codec = Codec<std::remove_const_t<A>>;
+  using second_codec = Codec<std::remove_const_t<B>>;
+
+  static constexpr bool kRaw = first_codec::kRaw && second_codec::kRaw;
+  static constexpr std::uint32_t kSize =
+      kRaw ? first_codec::kSize + second_codec::kSize : 0;
+  static constexpr std::uint32_t kMinSize =
+      first_codec::kMinSize + second_codec::kMinSize;
+
+  static void Put(std::string &buf, const std::pair<A, B> &value) {
+    first_codec::Put(buf, value.first);
+    second_codec::Put(buf, value.second);
+  }
+
+  static std::pair<A, B> Get(Cursor &cursor) {
+    auto first = first_codec::Get(cursor);
+    auto second = second_codec::Get(cursor);
+    return std::pair<A, B>(std::move(first), std::move(second));
+  }
+};
+
+template <class T>
+void WriteField(std::ostream &os, const T &value) {
+  os.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <class T>
+T ReadField(std::istream &is) {
+  T value{};
+  if (!is.read(reinterpret_cast<char *>(&value), sizeof(T))) {
+    throw std::runtime_error("s21::deserialize::unexpected end of stream");
+  }
+  return value;
+}
+
+template <class T>
+void WriteHeader(std::ostream &os, std::uint64_t count, std::uint16_t flags) {
+  using codec = Codec<T>;
+  os.write(kMagic, sizeof(kMagic));
+  WriteField(os, kVersion);
+  WriteField(os,
+             static_cast<std::uint16_t>(flags | (codec::kRaw ? kRawFlag : 0)));
+  WriteField(os, codec::kSize);
+  WriteField(os, count);
+}
+
+template <class T>
+Header ReadHeader(std::istream &is) {
+  char magic[sizeof(kMagic)];
+  if (!is.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+    throw std::runtime_error("s21::deserialize::bad magic");
+  }
+  Header header;
+  header.version = ReadField<std::uint16_t>(is);
+  header.flags = ReadField<std::uint16_t>(is);
+  header.value_size = ReadField<std::uint32_t>(is);
+  header.count = ReadField<std::uint64_t>(is);
+  if (header.version != kVersion) {
+    throw std::runtime_error("s21::deserialize::unsupported version");
+  }
+  if (header.value_size != Codec<T>::kSize) {
+    throw std::runtime_error("s21::deserialize::value type mismatch");
+  }
+  return header;
+}
+
+inline void WriteChunkHeader(std::ostream &os, std::uint64_t count,
+                             std::uint64_t bytes) {
+  WriteField(os, count);
+  WriteField(os, bytes);
+}
+
+template <class InputIt>
+void WriteEncodedChunk(std::ostream &os, InputIt first, InputIt last,
+                       std::uint64_t count) {
+  using value_type = std::decay_t<decltype(*first)>;
+  std::string buf;
+  if (Codec<value_type>::kRaw) buf.reserve(count * Codec<value_type>::kSize);
+  for (; first != last; ++first) Codec<value_type>::Put(buf, *first);
+  WriteChunkHeader(os, count, buf.size());
+  os.write(buf.data(), buf.size());
+}
+
+// Reads n bytes into data, throwing when the stream ends first.
+inline void ReadBytes(std::istream &is, char *data, std::uint64_t n) {
+  if (n != 0 && !is.read(data, static_cast<std::streamsize>(n))) {
+    throw std::runtime_error("s21::deserialize::truncated payload");
+  }
+}
+
+// Reads the next chunk into buf and returns its element count, 0 at the end.
+// Throws when the byte length cannot hold count values of T.
+template <class T>
+std::uint64_t ReadChunk(std::istream &is, std::string &buf) {
+  std::uint64_t count = ReadField<std::uint64_t>(is);
+  std::uint64_t bytes = ReadField<std::uint64_t>(is);
+  if (count > bytes / Codec<T>::kMinSize) {
+    throw std::runtime_error("s21::deserialize::corrupt chunk");
+  }
+  buf.clear();
+  while (buf.size() < bytes) {
+    size_t done = buf.size();
+    buf.resize(std::min<std::uint64_t>(bytes, std::max(kReadStep, 2 * done)));
+    ReadBytes(is, &buf[done], buf.size() - done);
+  }
+  return count;
+}
+
+// Decodes every remaining chunk, passing each value to f.
+template <class T, class F>
+void ForEachValue(std::istream &is, F f) {
+  std::string buf;
+  while (std::uint64_t count = ReadChunk<T>(is, buf)) {
+    Cursor cursor(buf.data(), buf.data() + buf.size());
+    for (std::uint64_t i = 0; i < count; ++i) f(Codec<T>::Get(cursor));
+  }
+}
+
+template <class InputIt>
+void WriteRange(std::ostream &os, InputIt first, InputIt last,
+                std::uint64_t count) {
+  using value_type = std::decay_t<decltype(*first)>;
+  WriteHeader<value_type>(os, count, 0);
+  if (count != 0) WriteEncodedChunk(os, first, last, count);
+  WriteChunkHeader(os, 0, 0);
+}
+
+template <class T>
+std::vector<T> ReadAll(std::istream &is) {
+  Header header = ReadHeader<T>(is);
+  std::vector<T> values;
+  if (header.count != kStreamed) {
+    values.reserve(std::min(header.count, kReserveLimit));
+  }
+  ForEachValue<T>(is, [&values](T &&value) {
+    values.push_back(std::move(value));
+  });
+  return values;
+}
+
+// Rebuilds an ordered container with the O(n) sorted build when the input is
+// strictly ascending by key, otherwise falls back to one insert per value.
+template <class Container, class T, class Less>
+void AssignOrdered(Container &c, std::vector<T> &values, Less less) {
+  bool ascending = true;
+  for (size_t i = 1; ascending && i < values.size(); ++i) {
+    ascending = less(values[i - 1], values[i]);
+  }
+  if (ascending) {
+    c.assign_sorted(values.begin(), values.end());
+  } else {
+    c.clear();
+    for (auto &value : values) c.insert(value);
+  }
+}
+
+}  // namespace serialization
+
+// Streams values in bounded chunks, so the whole data set never has to be in
+// memory; the result can be read back by deserialize or ChunkReader.
+template <class T>
+class ChunkWriter {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  explicit ChunkWriter(std::ostream &os, size_type chunk_size = 4096)
+      : os_(os), chunk_size_(chunk_size ? chunk_size : 1), count_(0) {
+    serialization::WriteHeader<value_type>(os_, serialization::kStreamed,
+                                           serialization::kChunkedFlag);
+  }
+
+  ChunkWriter(const ChunkWriter &) = delete;
+
+  ~ChunkWriter() { finish(); }
+
+  void write(const value_type &value) {
+    serialization::Codec<value_type>::Put(buf_, value);
+    if (++count_ == chunk_size_) flush();
+  }
+
+  template <class InputIt>
+  void write(InputIt first, InputIt last) {
+    for (; first != last; ++first) write(*first);
+  }
+
+  void flush() {
+    if (count_ == 0) return;
+    serialization::WriteChunkHeader(os_, count_, buf_.size());
+    os_.write(buf_.data(), buf_.size());
+    buf_.clear();
+    count_ = 0;
+  }
+
+  // Writes the end marker; further writes are ignored by readers.
+  void finish() {
+    if (finished_) return;
+    flush();
+    serialization::WriteChunkHeader(os_, 0, 0);
+    os_.flush();
+    finished_ = true;
+  }
+
+ private:
+  std::ostream &os_;
+  size_type chunk_size_;
+  size_type count_;
+  std::string buf_;
+  bool finished_ = false;
+};
+
+template <class T>
+class ChunkReader {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  explicit ChunkReader(std::istream &is)
+      : is_(is), header_(serialization::ReadHeader<value_type>(is)) {}
+
+  // Total element count, or kStreamed when the writer did not record it.
+  std::uint64_t count() const { return header_.count; }
+
+  // Replaces chunk with the next block of values; false once the stream ends.
+  bool next(std::vector<value_type> &chunk) {
+    chunk.clear();
+    if (done_) return false;
+    std::uint64_t n = serialization::ReadChunk<value_type>(is_, buf_);
+    if (n == 0) {
+      done_ = true;
+      return false;
+    }
+    chunk.reserve(n);
+    serialization::Cursor cursor(buf_.data(), buf_.data() + buf_.size());
+    for (std::uint64_t i = 0; i < n; ++i) {
+      chunk.push_back(serialization::Codec<value_type>::Get(cursor));
+    }
+    return true;
+  }
+
+ private:
+  std::istream &is_;
+  serialization::Header header_;
+  std::string buf_;
+  bool done_ = false;
+};
+
+// Vector: trivially copyable payloads go out and come back in one block.
+template <class T, class Allocator>
+void serialize(std::ostream &os, Vector<T, Allocator> &v) {
+  if (serialization::Codec<T>::kRaw) {
+    serialization::WriteHeader<T>(os, v.size(), 0);
+    if (v.size() != 0) {
+      serialization::WriteChunkHeader(os, v.size(), v.size() * sizeof(T));
+      os.write(reinterpret_cast<const char *>(v.data()), v.size() * sizeof(T));
+    }
+    serialization::WriteChunkHeader(os, 0, 0);
+  } else {
+    serialization::WriteRange(os, v.begin(), v.end(), v.size());
+  }
+}
+
+template <class T, class Allocator>
+void deserialize(std::istream &is, Vector<T, Allocator> &v) {
+  serialization::Header header = serialization::ReadHeader<T>(is);
+  Vector<T, Allocator> result(v.get_allocator());
+  if (serialization::Codec<T>::kRaw &&
+      header.count != serialization::kStreamed) {
+    std::uint64_t count = serialization::ReadField<std::uint64_t>(is);
+    std::uint64_t bytes = serialization::ReadField<std::uint64_t>(is);
+    if (count != header.count ||
+        count > std::numeric_limits<std::uint64_t>::max() / sizeof(T) ||
+        bytes != count * sizeof(T)) {
+      throw std::runtime_error("s21::deserialize::corrupt chunk");
+    }
+    if (count != 0) {
+      // Grows the block as the payload arrives, copying what was read so far
+      // into each larger one, so a count the stream cannot back fails as
+      // truncated after allocating at most twice the bytes received.
+      constexpr std::uint64_t kFirst =
+          std::max<std::uint64_t>(serialization::kReadStep / sizeof(T), 1);
+      std::uint64_t done = 0;
+      while (done < count) {
+        std::uint64_t size = std::min(count, std::max(kFirst, 2 * done));
+        Vector<T, Allocator> block(size, v.get_allocator());
+        std::copy(result.data(), result.data() + done, block.data());
+        result.swap(block);
+        serialization::ReadBytes(is,
+                                 reinterpret_cast<char *>(result.data() + done),
+                                 (size - done) * sizeof(T));
+        done = size;
+      }
+      if (serialization::ReadField<std::uint64_t>(is) != 0 ||
+          serialization::ReadField<std::uint64_t>(is) != 0) {
+        throw std::runtime_error("s21::deserialize::corrupt chunk");
+      }
+    }
+  } else {
+    if (header.count != serialization::kStreamed) {
+      result.reserve(std::min(header.count, serialization::kReserveLimit));
+    }
+    serialization::ForEachValue<T>(
+        is, [&result](T &&value) { result.push_back(std::move(value)); });
+  }
+  v.swap(result);
+}
+
+template <class T, size_t N>
+void serialize(std::ostream &os, Array<T, N> &a) {
+  serialization::WriteRange(os, a.begin(), a.end(), a.size());
+}
+
+template <class T, size_t N>
+void deserialize(std::istream &is, Array<T, N> &a) {
+  std::vector<T> values = serialization::ReadAll<T>(is);
+  if (values.size() != N) {
+    throw std::out_of_range("s21::Array::limit is exceeded");
+  }
+  std::move(values.begin(), values.end(), a.begin());
+}
+
+template <class T, class Allocator>
+void serialize(std::ostream &os, List<T, Allocator> &l) {
+  serialization::WriteRange(os, l.begin(), l.end(), l.size());
+}
+
+template <class T, class Allocator>
+void deserialize(std::istream &is, List<T, Allocator> &l) {
+  serialization::ReadHeader<T>(is);
+  List<T, Allocator> result(l.get_allocator());
+  serialization::ForEachValue<T>(
+      is, [&result](T &&value) { result.push_back(std::move(value)); });
+  l.swap(result);
+}
+
+template <class T, class Allocator>
+void serialize(std::ostream &os, Deque<T, Allocator> &d) {
+  serialization::WriteRange(os, d.begin(), d.end(), d.size());
+}
+
+template <class T, class Allocator>
+void deserialize(std::istream &is, Deque<T, Allocator> &d) {
+  serialization::ReadHeader<T>(is);
+  Deque<T, Allocator> result(d.get_allocator());
+  serialization::ForEachValue<T>(
+      is, [&result](T &&value) { result.emplace_back(std::move(value)); });
+  d.swap(result);
+}
+
+template <class K, class C, class Allocator, class Tag>
+void serialize(std::ostream &os, BinaryTree<K, C, Allocator, Tag> &t) {
+  serialization::WriteRange(os, t.begin(), t.end(), t.size());
+}
+
+template <class K, class C, class Allocator, class Tag>
+void deserialize(std::istream &is, BinaryTree<K, C, Allocator, Tag> &t) {
+  std::vector<K> values = serialization::ReadAll<K>(is);
+  serialization::AssignOrdered(
+      t, values, [](const K &a, const K &b) { return a < b; });
+}
+
+template <class K, class C>
+void serialize(std::ostream &os, Set<K, C> &s) {
+  serialization::WriteRange(os, s.begin(), s.end(), s.size());
+}
+
+template <class K, class C>
+void deserialize(std::istream &is, Set<K, C> &s) {
+  std::vector<K> values = serialization::ReadAll<K>(is);
+  serialization::AssignOrdered(
+      s, values, [](const K &a, const K &b) { return a < b; });
+}
+
+template <class K, class T, class Allocator>
+void serialize(std::ostream &os, Map<K, T, Allocator> &m) {
+  serialization::WriteRange(os, m.begin(), m.end(), m.size());
+}
+
+template <class K, class T, class Allocator>
+void deserialize(std::istream &is, Map<K, T, Allocator> &m) {
+  using value_type = typename Map<K, T, Allocator>::value_type;
+  std::vector<value_type> values = serialization::ReadAll<value_type>(is);
+  serialization::AssignOrdered(
+      m, values,
+      [](const value_type &a, const value_type &b) {
+        return a.first < b.first;
+      });
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_SERIALIZE_H_
@@ -14,16 +14,23 @@ class Set {
   using iterator = typename Container::Iterator;
   using const_iterator = typename Container::ConstIterator;
   using size_type = size_t;
+  using allocator_type = typename Container::allocator_type;
 
   // set member functions
   Set() {}
 
+  explicit Set(const allocator_type &alloc) : bt(alloc) {}
+
   Set(std::initializer_list<value_type> const &items) : bt(items) {}
 
   Set(const Set &s) : bt(s.bt) {}
 
+  Set(const Set &s, const allocator_type &alloc) : bt(s.bt, alloc) {}
+
   Set(Set &&s) : bt(std::move(s.bt)) {}
 
+  Set(Set &&s, const allocator_type &alloc) : bt(std::move(s.bt), alloc) {}
+
   ~Set() {}
 
   Set &operator=(Set &&s) {
@@ -56,6 +63,13 @@ class Set {
 
   void merge(Set &other) { bt.merge(other.bt); }
 
+  allocator_type get_allocator() const { return bt.get_allocator(); }
+
+  template <class RandomIt>
+  void assign_sorted(RandomIt first, RandomIt last) {
+    bt.assign_sorted(first, last);
+  }
+
   // set lookup
   iterator find(const Key &key) { return bt.find(key); }
 
@@ -0,0 +1,186 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_SPSC_QUEUE_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "s21_alloc_stats.h"
+#include "s21_node_pool.h"
+
+namespace s21 {
+
+// Bounded wait-free queue for exactly one producer thread and one consumer
+// thread. The indices grow without wrapping and are masked into a
+// power-of-two ring. Each side owns its index on its own cache line, next to
+// a cached copy of the other side's index, so the shared lines are touched
+// only when the cached view says the ring is full or empty. Only acquire
+// and release ordering is used.
+//
+// push, try_push and push_n belong to the producer; front, pop, try_pop and
+// pop_n to the consumer. size and empty may be called from either side and
+// are a snapshot.
+template <class T,
+          class Allocator = DefaultAllocator<T, alloc_stats::SpscQueueTag>>
+class SpscQueue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  // The capacity is rounded up to a power of two.
+  explicit SpscQueue(size_type capacity,
+                     const allocator_type &alloc = allocator_type())
+      : alloc_(alloc) {
+    if (capacity == 0) {
+      throw std::length_error("s21::SpscQueue::capacity must be positive");
+    }
+    size_type rounded = 1;
+    while (rounded < capacity) rounded <<= 1;
+    mask_ = rounded - 1;
+    buf_ = traits::allocate(alloc_, rounded);
+  }
+
+  SpscQueue(const SpscQueue &) = delete;
+
+  SpscQueue &operator=(const SpscQueue &) = delete;
+
+  ~SpscQueue() {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (; head != tail; ++head) traits::destroy(alloc_, Slot(head));
+    traits::deallocate(alloc_, buf_, capacity());
+  }
+
+  size_type capacity() const { return mask_ + 1; }
+
+  size_type size() const {
+    size_type head = head_.load(std::memory_order_acquire);
+    size_type tail = tail_.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  allocator_type get_allocator() const { return alloc_; }
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  template <class... Args>
+  bool try_emplace(Args &&...args) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_cache_ == capacity()) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      if (tail - head_cache_ == capacity()) return false;
+    }
+    traits::construct(alloc_, Slot(tail), std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Spins, yielding, until there is room.
+  void push(const_reference value) {
+    while (!try_push(value)) std::this_thread::yield();
+  }
+
+  void push(value_type &&value) {
+    while (!try_push(std::move(value))) std::this_thread::yield();
+  }
+
+  // Pushes up to n values from first, publishing them with one store, and
+  // returns how many fit.
+  template <class InputIt>
+  size_type push_n(InputIt first, size_type n) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (capacity() - (tail - head_cache_) < n) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+    }
+    size_type room = capacity() - (tail - head_cache_);
+    if (n > room) n = room;
+    size_type done = 0;
+    try {
+      for (; done < n; ++done, ++first) {
+        traits::construct(alloc_, Slot(tail + done), *first);
+      }
+    } catch (...) {
+      tail_.store(tail + done, std::memory_order_release);
+      throw;
+    }
+    tail_.store(tail + n, std::memory_order_release);
+    return n;
+  }
+
+  // The queue must not be empty.
+  reference front() { return *Slot(head_.load(std::memory_order_relaxed)); }
+
+  // Removes the front element; the queue must not be empty.
+  void pop() {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (head == tail_cache_) {
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+    }
+    traits::destroy(alloc_, Slot(head));
+    head_.store(head + 1, std::memory_order_release);
+  }
+
+  bool try_pop(reference out) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (head == tail_cache_) {
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+      if (head == tail_cache_) return false;
+    }
+    T *slot = Slot(head);
+    out = std::move(*slot);
+    traits::destroy(alloc_, slot);
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Moves up to n values to out, releasing their slots with one store, and
+  // returns how many there were.
+  template <class OutputIt>
+  size_type pop_n(OutputIt out, size_type n) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (tail_cache_ - head < n) {
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+    }
+    size_type available = tail_cache_ - head;
+    if (n > available) n = available;
+    for (size_type i = 0; i < n; ++i, ++out) {
+      T *slot = Slot(head + i);
+      *out = std::move(*slot);
+      traits::destroy(alloc_, slot);
+    }
+    head_.store(head + n, std::memory_order_release);
+    return n;
+  }
+
+ private:
+  using traits = std::allocator_traits<Allocator>;
+
+  T *Slot(size_type index) const { return buf_ + (index & mask_); }
+
+  // Read-only after construction.
+  alignas(kCacheLineSize) T *buf_;
+  size_type mask_;
+  allocator_type alloc_;
+
+  // Producer side.
+  alignas(kCacheLineSize) std::atomic<size_type> tail_{0};
+  size_type head_cache_ = 0;
+
+  // Consumer side.
+  alignas(kCacheLineSize) std::atomic<size_type> head_{0};
+  size_type tail_cache_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_SPSC_QUEUE_H_
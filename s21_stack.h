@@ -27,7 +27,7 @@ class Stack {
     return *this;
   }
 
-  const_reference top() { return c.end(); }
+  const_reference top() { return c.back(); }
 
   bool empty() { return c.empty(); }
 
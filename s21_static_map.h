@@ -0,0 +1,205 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_STATIC_MAP_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_STATIC_MAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "s21_array.h"
+
+namespace s21 {
+
+// Seeded hashes usable in constant expressions. StaticMap needs a family of
+// independent functions, one per seed, rather than a single std::hash.
+template <class Key, class = void>
+struct StaticHash;
+
+namespace static_map {
+
+constexpr std::uint64_t Mix(std::uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+}  // namespace static_map
+
+template <class Key>
+struct StaticHash<Key,
+                  std::enable_if_t<std::is_integral_v<Key> ||
+                                   std::is_enum_v<Key>>> {
+  constexpr std::uint64_t operator()(Key key, std::uint64_t seed) const {
+    return static_map::Mix(static_cast<std::uint64_t>(key) +
+                           seed * 0x9e3779b97f4a7c15ULL);
+  }
+};
+
+template <>
+struct StaticHash<std::string_view> {
+  // FNV-1a from a seed-dependent basis, then a final mix.
+  constexpr std::uint64_t operator()(std::string_view key,
+                                     std::uint64_t seed) const {
+    std::uint64_t h = 0xcbf29ce484222325ULL ^ static_map::Mix(seed);
+    for (char c : key) {
+      h ^= static_cast<unsigned char>(c);
+      h *= 0x100000001b3ULL;
+    }
+    return static_map::Mix(h);
+  }
+};
+
+template <class Key, class Value>
+struct StaticMapEntry {
+  Key first{};
+  Value second{};
+};
+
+// Immutable map built in a constant expression around a minimal perfect
+// hash (hash and displace): keys are split into N buckets by one hash, and
+// each bucket, largest first, gets the first seed that sends all its keys to
+// still free slots of the N-slot table. A lookup is two hashes and one key
+// compare; storage is two Arrays and nothing is allocated.
+//
+// Keys are integers, enums or std::string_view; Value must be a literal
+// type with a default constructor.
+template <class Key, class Value, size_t N, class Hash = StaticHash<Key>>
+class StaticMap {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = StaticMapEntry<Key, Value>;
+  using const_reference = const value_type &;
+  using const_iterator = const value_type *;
+  using size_type = size_t;
+
+  // Throws invalid_argument on a duplicate key, which inside a constant
+  // expression turns into a compile error.
+  constexpr explicit StaticMap(const value_type (&items)[N])
+      : entries_(), seeds_() {
+    if constexpr (N > 0) Build(items);
+  }
+
+  // The entries in table order.
+  constexpr const_iterator begin() const { return entries_.begin(); }
+
+  constexpr const_iterator end() const { return entries_.end(); }
+
+  constexpr size_type size() const { return N; }
+
+  constexpr bool empty() const { return N == 0; }
+
+  // Returns nullptr if key is absent.
+  constexpr const Value *find(const Key &key) const {
+    if constexpr (N == 0) {
+      return nullptr;
+    } else {
+      const value_type &entry =
+          entries_[Slot(key, seeds_[Slot(key, 0)])];
+      return entry.first == key ? &entry.second : nullptr;
+    }
+  }
+
+  constexpr bool contains(const Key &key) const {
+    return find(key) != nullptr;
+  }
+
+  constexpr const Value &at(const Key &key) const {
+    const Value *value = find(key);
+    if (value == nullptr) {
+      throw std::out_of_range("s21::StaticMap::at key not found");
+    }
+    return *value;
+  }
+
+ private:
+  // Gives up on a bucket after this many seeds; with N buckets for N keys a
+  // bucket needs about N tries in the worst case.
+  static constexpr std::uint32_t kMaxSeed = 1u << 24;
+
+  Array<value_type, N> entries_;
+  Array<std::uint32_t, N> seeds_;
+
+  static constexpr size_type Slot(const Key &key, std::uint64_t seed) {
+    return static_cast<size_type>(Hash()(key, seed) % N);
+  }
+
+  constexpr void Build(const value_type (&items)[N]) {
+    Array<size_type, N> bucket{};
+    Array<size_type, N> count{};
+    Array<size_type, N> order{};
+    Array<size_type, N> slots{};
+    Array<bool, N> used{};
+    for (size_type i = 0; i < N; ++i) {
+      bucket[i] = Slot(items[i].first, 0);
+      ++count[bucket[i]];
+      order[i] = i;
+    }
+    // Keys grouped by bucket, largest buckets first.
+    sort(order, [&bucket, &count](size_type a, size_type b) {
+      if (count[bucket[a]] != count[bucket[b]]) {
+        return count[bucket[a]] > count[bucket[b]];
+      }
+      return bucket[a] < bucket[b];
+    });
+    for (size_type first = 0; first < N;) {
+      size_type b = bucket[order[first]];
+      size_type last = first + count[b];
+      for (size_type i = first; i < last; ++i) {
+        for (size_type j = i + 1; j < last; ++j) {
+          if (items[order[i]].first == items[order[j]].first) {
+            throw std::invalid_argument("s21::StaticMap: duplicate key");
+          }
+        }
+      }
+      for (std::uint32_t seed = 1;; ++seed) {
+        if (seed == kMaxSeed) {
+          throw std::length_error("s21::StaticMap: no perfect hash found");
+        }
+        if (Fits(items, order, first, last, seed, used, slots)) {
+          for (size_type i = first; i < last; ++i) {
+            used[slots[i - first]] = true;
+            entries_[slots[i - first]] = items[order[i]];
+          }
+          seeds_[b] = seed;
+          break;
+        }
+      }
+      first = last;
+    }
+  }
+
+  // Whether seed sends the keys order[first, last) to distinct free slots,
+  // which are left in slots.
+  static constexpr bool Fits(const value_type (&items)[N],
+                             const Array<size_type, N> &order,
+                             size_type first, size_type last,
+                             std::uint32_t seed, const Array<bool, N> &used,
+                             Array<size_type, N> &slots) {
+    for (size_type i = first; i < last; ++i) {
+      size_type slot = Slot(items[order[i]].first, seed);
+      if (used[slot]) return false;
+      for (size_type j = 0; j < i - first; ++j) {
+        if (slots[j] == slot) return false;
+      }
+      slots[i - first] = slot;
+    }
+    return true;
+  }
+};
+
+// Deduces N from a braced list, e.g.
+//   constexpr auto kOps = MakeStaticMap<std::string_view, int>(
+//       {{"add", 1}, {"sub", 2}});
+template <class Key, class Value, size_t N>
+constexpr StaticMap<Key, Value, N> MakeStaticMap(
+    const StaticMapEntry<Key, Value> (&items)[N]) {
+  return StaticMap<Key, Value, N>(items);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_STATIC_MAP_H_
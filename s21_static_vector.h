@@ -0,0 +1,270 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_STATIC_VECTOR_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_STATIC_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_array.h"
+
+namespace s21 {
+
+namespace static_vector {
+
+// Raw room for one T. An Array of these is never constructed element-wise,
+// so unused slots stay untouched.
+template <class T>
+struct Slot {
+  alignas(T) unsigned char bytes[sizeof(T)];
+};
+
+// Element storage and the special members. For a trivially copyable T they
+// are all implicit, which makes the whole StaticVector trivially copyable:
+// it can be memcpy'd, and copying it is one fixed-size block copy.
+template <class T, size_t N, bool = std::is_trivially_copyable_v<T>>
+class Storage {
+ protected:
+  Storage() = default;
+
+  void *Raw(size_t index) { return slots_[index].bytes; }
+
+  T *Ptr(size_t index) {
+    return std::launder(reinterpret_cast<T *>(slots_[index].bytes));
+  }
+
+  const T *Ptr(size_t index) const {
+    return std::launder(reinterpret_cast<const T *>(slots_[index].bytes));
+  }
+
+  void DestroyAll() { size_ = 0; }
+
+  Array<Slot<T>, N> slots_;
+  size_t size_ = 0;
+};
+
+template <class T, size_t N>
+class Storage<T, N, false> {
+ protected:
+  Storage() = default;
+
+  Storage(const Storage &other) {
+    for (; size_ < other.size_; ++size_) {
+      ::new (Raw(size_)) T(*other.Ptr(size_));
+    }
+  }
+
+  Storage(Storage &&other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    for (; size_ < other.size_; ++size_) {
+      ::new (Raw(size_)) T(std::move(*other.Ptr(size_)));
+    }
+  }
+
+  ~Storage() { DestroyAll(); }
+
+  Storage &operator=(const Storage &other) {
+    if (this != &other) Assign(other);
+    return *this;
+  }
+
+  Storage &operator=(Storage &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T> &&
+      std::is_nothrow_move_assignable_v<T>) {
+    if (this != &other) Assign(std::move(other));
+    return *this;
+  }
+
+  void *Raw(size_t index) { return slots_[index].bytes; }
+
+  T *Ptr(size_t index) {
+    return std::launder(reinterpret_cast<T *>(slots_[index].bytes));
+  }
+
+  const T *Ptr(size_t index) const {
+    return std::launder(reinterpret_cast<const T *>(slots_[index].bytes));
+  }
+
+  void DestroyAll() {
+    while (size_ > 0) Ptr(--size_)->~T();
+  }
+
+  Array<Slot<T>, N> slots_;
+  size_t size_ = 0;
+
+ private:
+  // Assigns over the common prefix, then constructs or destroys the rest.
+  template <class Other>
+  void Assign(Other &&other) {
+    size_t common = size_ < other.size_ ? size_ : other.size_;
+    for (size_t i = 0; i < common; ++i) {
+      if constexpr (std::is_rvalue_reference_v<Other &&>) {
+        *Ptr(i) = std::move(*other.Ptr(i));
+      } else {
+        *Ptr(i) = *other.Ptr(i);
+      }
+    }
+    while (size_ > other.size_) Ptr(--size_)->~T();
+    for (; size_ < other.size_; ++size_) {
+      if constexpr (std::is_rvalue_reference_v<Other &&>) {
+        ::new (Raw(size_)) T(std::move(*other.Ptr(size_)));
+      } else {
+        ::new (Raw(size_)) T(*other.Ptr(size_));
+      }
+    }
+  }
+};
+
+}  // namespace static_vector
+
+// Vector with the capacity N fixed at compile time and the elements stored
+// inline, in an Array of uninitialized slots: only the first size() slots
+// hold constructed objects, and nothing ever touches the heap. Growing past
+// N throws std::length_error. Moving moves the elements one by one, so
+// iterators of the source are not carried over.
+template <class T, size_t N>
+class StaticVector : private static_vector::Storage<T, N> {
+  using Base = static_vector::Storage<T, N>;
+  using Base::Ptr;
+  using Base::Raw;
+  using Base::size_;
+  using Base::slots_;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  StaticVector() = default;
+
+  explicit StaticVector(size_type n) {
+    CheckCapacity(n);
+    for (; size_ < n; ++size_) ::new (Raw(size_)) T();
+  }
+
+  StaticVector(std::initializer_list<value_type> const &items) {
+    CheckCapacity(items.size());
+    for (const_reference item : items) {
+      ::new (Raw(size_)) T(item);
+      ++size_;
+    }
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("s21::StaticVector::at");
+    return *Ptr(pos);
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("s21::StaticVector::at");
+    return *Ptr(pos);
+  }
+
+  reference operator[](size_type pos) { return *Ptr(pos); }
+
+  const_reference operator[](size_type pos) const { return *Ptr(pos); }
+
+  reference front() { return *Ptr(0); }
+
+  const_reference front() const { return *Ptr(0); }
+
+  reference back() { return *Ptr(size_ - 1); }
+
+  const_reference back() const { return *Ptr(size_ - 1); }
+
+  // A plain cast, not Ptr(): slot 0 may hold no object to launder, and
+  // with N == 0 there is no slot 0 at all, only Array's spare element.
+  value_type *data() noexcept {
+    return reinterpret_cast<value_type *>(slots_.data());
+  }
+
+  const value_type *data() const noexcept {
+    return reinterpret_cast<const value_type *>(slots_.data());
+  }
+
+  iterator begin() noexcept { return data(); }
+
+  iterator end() noexcept { return data() + size_; }
+
+  const_iterator begin() const noexcept { return data(); }
+
+  const_iterator end() const noexcept { return data() + size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  bool full() const { return size_ == N; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const { return N; }
+
+  size_type capacity() const { return N; }
+
+  // The storage is fixed: reserve only checks that size fits.
+  void reserve(size_type size) { CheckCapacity(size); }
+
+  void shrink_to_fit() {}
+
+  void clear() { Base::DestroyAll(); }
+
+  iterator insert(iterator pos, const_reference value) {
+    size_type index = pos - begin();
+    CheckCapacity(size_ + 1);
+    if (index == size_) {
+      emplace_back(value);
+      return begin() + index;
+    }
+    value_type copy = value;
+    ::new (Raw(size_)) T(std::move(back()));
+    ++size_;
+    std::move_backward(begin() + index, end() - 2, end() - 1);
+    *Ptr(index) = std::move(copy);
+    return begin() + index;
+  }
+
+  void erase(iterator pos) {
+    if (pos >= begin() && pos < end()) {
+      std::move(pos + 1, end(), pos);
+      pop_back();
+    }
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    CheckCapacity(size_ + 1);
+    ::new (Raw(size_)) T(std::forward<Args>(args)...);
+    ++size_;
+    return back();
+  }
+
+  void pop_back() {
+    if (size_ > 0) Ptr(--size_)->~T();
+  }
+
+  void swap(StaticVector &other) {
+    StaticVector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+ private:
+  static void CheckCapacity(size_type size) {
+    if (size > N) {
+      throw std::length_error("s21::StaticVector::capacity is exceeded");
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_STATIC_VECTOR_H_
@@ -0,0 +1,383 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_STATS_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_STATS_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Operation stats of the containers: latency histograms of insert, find and
+// erase, and structural counters. Recording is compiled in only when
+// S21_STATS is defined for the whole program; otherwise the hooks the
+// containers call are empty and cost nothing.
+namespace s21 {
+
+namespace stats {
+
+enum class Op { kInsert, kFind, kErase };
+
+enum class Counter { kComparisons, kNodesVisited, kReallocations, kBytesMoved };
+
+inline constexpr std::size_t kOpCount = 3;
+inline constexpr std::size_t kCounterCount = 4;
+
+inline const char *Name(Op op) {
+  static const char *const kNames[kOpCount] = {"insert", "find", "erase"};
+  return kNames[static_cast<std::size_t>(op)];
+}
+
+inline const char *Name(Counter counter) {
+  static const char *const kNames[kCounterCount] = {
+      "comparisons", "nodes_visited", "reallocations", "bytes_moved"};
+  return kNames[static_cast<std::size_t>(counter)];
+}
+
+// Log-linear buckets as in HdrHistogram: every power of two is split into
+// kSubBuckets equal parts, so a value is known to within 1/8 of itself.
+class Histogram {
+ public:
+  static constexpr int kSubBits = 3;
+  static constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBits;
+  static constexpr std::size_t kBuckets = (64 - kSubBits + 1) * kSubBuckets;
+
+  static std::size_t Bucket(std::uint64_t value) {
+    if (value < kSubBuckets) return static_cast<std::size_t>(value);
+    int log = Log2(value);
+    return static_cast<std::size_t>(log - kSubBits + 1) * kSubBuckets +
+           ((value >> (log - kSubBits)) & (kSubBuckets - 1));
+  }
+
+  static std::uint64_t LowerBound(std::size_t bucket) {
+    if (bucket < kSubBuckets) return bucket;
+    int log = static_cast<int>(bucket / kSubBuckets) + kSubBits - 1;
+    return (kSubBuckets + bucket % kSubBuckets) << (log - kSubBits);
+  }
+
+  static std::uint64_t UpperBound(std::size_t bucket) {
+    return bucket + 1 == kBuckets ? UINT64_MAX : LowerBound(bucket + 1) - 1;
+  }
+
+  void Record(std::uint64_t value, std::uint64_t times = 1) {
+    counts_[Bucket(value)] += times;
+    count_ += times;
+    sum_ += value * times;
+    if (value > max_) max_ = value;
+  }
+
+  void Merge(const Histogram &other) {
+    for (std::size_t i = 0; i < kBuckets; ++i) counts_[i] += other.counts_[i];
+    count_ += other.count_;
+    sum_ += other.sum_;
+    if (other.max_ > max_) max_ = other.max_;
+  }
+
+  std::uint64_t Count() const { return count_; }
+  std::uint64_t Max() const { return max_; }
+  std::uint64_t CountAt(std::size_t bucket) const { return counts_[bucket]; }
+
+  double Mean() const {
+    return count_ == 0 ? 0 : static_cast<double>(sum_) / count_;
+  }
+
+  // The largest value of the bucket holding the p-th percentile, p in
+  // [0, 100]; never above the largest value recorded.
+  std::uint64_t Percentile(double p) const {
+    if (count_ == 0) return 0;
+    std::uint64_t rank = static_cast<std::uint64_t>(p / 100 * count_ + 0.5);
+    if (rank == 0) rank = 1;
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBuckets; ++i) {
+      seen += counts_[i];
+      if (seen >= rank) return UpperBound(i) < max_ ? UpperBound(i) : max_;
+    }
+    return max_;
+  }
+
+ private:
+  static int Log2(std::uint64_t value) {
+    int log = 0;
+    for (int shift = 32; shift > 0; shift /= 2) {
+      if (value >> shift) {
+        value >>= shift;
+        log += shift;
+      }
+    }
+    return log;
+  }
+
+  friend class Block;
+
+  std::array<std::uint64_t, kBuckets> counts_{};
+  std::uint64_t count_ = 0;
+  std::uint64_t sum_ = 0;
+  std::uint64_t max_ = 0;
+};
+
+// One container type, summed over all threads.
+struct TypeStats {
+  std::string name;
+  std::array<std::uint64_t, kCounterCount> counters{};
+  std::array<Histogram, kOpCount> latency_ns;
+  Histogram nodes_per_find;
+
+  std::uint64_t count(Counter counter) const {
+    return counters[static_cast<std::size_t>(counter)];
+  }
+
+  const Histogram &latency(Op op) const {
+    return latency_ns[static_cast<std::size_t>(op)];
+  }
+};
+
+// What one thread recorded for one container type. Only the owning thread
+// writes, so updates are plain loads and stores; readers sum the blocks of
+// all threads without locking.
+class Block {
+ public:
+  explicit Block(const char *name) : name_(name) {}
+
+  void Add(Counter counter, std::uint64_t n) {
+    Bump(counters_[static_cast<std::size_t>(counter)], n);
+  }
+
+  void RecordLatency(Op op, std::uint64_t ns) {
+    latency_[static_cast<std::size_t>(op)].Record(ns);
+  }
+
+  void RecordNodesPerFind(std::uint64_t nodes) {
+    nodes_per_find_.Record(nodes);
+  }
+
+  const char *name() const { return name_; }
+
+  void AddTo(TypeStats &stats) const {
+    for (std::size_t i = 0; i < kCounterCount; ++i) {
+      stats.counters[i] += counters_[i].load(std::memory_order_relaxed);
+    }
+    for (std::size_t i = 0; i < kOpCount; ++i) {
+      latency_[i].AddTo(stats.latency_ns[i]);
+    }
+    nodes_per_find_.AddTo(stats.nodes_per_find);
+  }
+
+  // Not exact while the owning thread is recording.
+  void Reset() {
+    for (auto &n : counters_) n.store(0, std::memory_order_relaxed);
+    for (auto &cells : latency_) cells.Reset();
+    nodes_per_find_.Reset();
+  }
+
+ private:
+  friend class Registry;
+
+  class Cells {
+   public:
+    void Record(std::uint64_t value) {
+      Bump(counts_[Histogram::Bucket(value)], 1);
+      Bump(count_, 1);
+      Bump(sum_, value);
+      if (value > max_.load(std::memory_order_relaxed)) {
+        max_.store(value, std::memory_order_relaxed);
+      }
+    }
+
+    void AddTo(Histogram &histogram) const {
+      for (std::size_t i = 0; i < Histogram::kBuckets; ++i) {
+        histogram.counts_[i] += counts_[i].load(std::memory_order_relaxed);
+      }
+      histogram.count_ += count_.load(std::memory_order_relaxed);
+      histogram.sum_ += sum_.load(std::memory_order_relaxed);
+      std::uint64_t max = max_.load(std::memory_order_relaxed);
+      if (max > histogram.max_) histogram.max_ = max;
+    }
+
+    void Reset() {
+      for (auto &n : counts_) n.store(0, std::memory_order_relaxed);
+      count_.store(0, std::memory_order_relaxed);
+      sum_.store(0, std::memory_order_relaxed);
+      max_.store(0, std::memory_order_relaxed);
+    }
+
+   private:
+    std::array<std::atomic<std::uint64_t>, Histogram::kBuckets> counts_{};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::uint64_t> sum_{0};
+    std::atomic<std::uint64_t> max_{0};
+  };
+
+  static void Bump(std::atomic<std::uint64_t> &cell, std::uint64_t n) {
+    cell.store(cell.load(std::memory_order_relaxed) + n,
+               std::memory_order_relaxed);
+  }
+
+  const char *name_;
+  std::array<std::atomic<std::uint64_t>, kCounterCount> counters_{};
+  std::array<Cells, kOpCount> latency_;
+  Cells nodes_per_find_;
+  Block *next_ = nullptr;
+};
+
+// All blocks of all threads in a lock-free list. Blocks are never freed:
+// what a thread recorded outlives it.
+class Registry {
+ public:
+  static Block *Add(const char *name) {
+    Block *block = new Block(name);
+    block->next_ = Head().load(std::memory_order_relaxed);
+    while (!Head().compare_exchange_weak(block->next_, block,
+                                         std::memory_order_release)) {
+    }
+    return block;
+  }
+
+  template <class F>
+  static void ForEachBlock(F f) {
+    for (Block *block = Head().load(std::memory_order_acquire);
+         block != nullptr; block = block->next_) {
+      f(*block);
+    }
+  }
+
+ private:
+  static std::atomic<Block *> &Head() {
+    static std::atomic<Block *> head{nullptr};
+    return head;
+  }
+};
+
+// The calling thread's block for the container type named by Tag.
+template <class Tag>
+Block &Local() {
+  thread_local Block *block = Registry::Add(Tag::kName);
+  return *block;
+}
+
+#ifdef S21_STATS
+inline constexpr bool kEnabled = true;
+
+template <class Tag>
+void Count(Counter counter, std::uint64_t n = 1) {
+  Local<Tag>().Add(counter, n);
+}
+
+// Times one operation of a Tag container and counts the work it does; the
+// totals go to the thread's block when the probe goes out of scope.
+template <class Tag>
+class Probe {
+ public:
+  explicit Probe(Op op) : op_(op), start_(std::chrono::steady_clock::now()) {}
+  Probe(const Probe &) = delete;
+  Probe &operator=(const Probe &) = delete;
+
+  ~Probe() {
+    auto elapsed = std::chrono::steady_clock::now() - start_;
+    Block &block = Local<Tag>();
+    block.RecordLatency(
+        op_, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                 .count());
+    block.Add(Counter::kComparisons, comparisons_);
+    block.Add(Counter::kNodesVisited, visited_);
+    if (op_ == Op::kFind) block.RecordNodesPerFind(visited_);
+  }
+
+  void Compare() { ++comparisons_; }
+  void Visit() { ++visited_; }
+
+ private:
+  Op op_;
+  std::chrono::steady_clock::time_point start_;
+  std::uint64_t comparisons_ = 0;
+  std::uint64_t visited_ = 0;
+};
+#else
+inline constexpr bool kEnabled = false;
+
+template <class Tag>
+void Count(Counter, std::uint64_t = 1) {}
+
+template <class Tag>
+class Probe {
+ public:
+  explicit Probe(Op) {}
+  void Compare() {}
+  void Visit() {}
+};
+#endif
+
+// Empty unless built with S21_STATS.
+inline std::vector<TypeStats> Collect() {
+  std::map<std::string, TypeStats> by_name;
+  Registry::ForEachBlock([&by_name](const Block &block) {
+    TypeStats &stats = by_name[block.name()];
+    stats.name = block.name();
+    block.AddTo(stats);
+  });
+  std::vector<TypeStats> result;
+  for (auto &entry : by_name) result.push_back(std::move(entry.second));
+  return result;
+}
+
+inline void Reset() {
+  Registry::ForEachBlock([](Block &block) { block.Reset(); });
+}
+
+inline void PrintJson(std::ostream &out, const Histogram &histogram) {
+  out << "{\"count\": " << histogram.Count()
+      << ", \"mean\": " << histogram.Mean()
+      << ", \"p50\": " << histogram.Percentile(50)
+      << ", \"p90\": " << histogram.Percentile(90)
+      << ", \"p99\": " << histogram.Percentile(99)
+      << ", \"p999\": " << histogram.Percentile(99.9)
+      << ", \"max\": " << histogram.Max() << ", \"buckets\": [";
+  const char *separator = "";
+  for (std::size_t i = 0; i < Histogram::kBuckets; ++i) {
+    if (histogram.CountAt(i) == 0) continue;
+    out << separator << "[" << Histogram::LowerBound(i) << ", "
+        << histogram.CountAt(i) << "]";
+    separator = ", ";
+  }
+  out << "]}";
+}
+
+// One object per container type, keyed by its name; bucket lists hold
+// [lowest value, count] pairs.
+inline void PrintJson(std::ostream &out) {
+  out << "{";
+  const char *separator = "";
+  for (const TypeStats &stats : Collect()) {
+    out << separator << "\"" << stats.name << "\": {\"counters\": {";
+    for (std::size_t i = 0; i < kCounterCount; ++i) {
+      out << (i == 0 ? "" : ", ") << "\"" << Name(static_cast<Counter>(i))
+          << "\": " << stats.counters[i];
+    }
+    out << "}, \"latency_ns\": {";
+    for (std::size_t i = 0; i < kOpCount; ++i) {
+      out << (i == 0 ? "" : ", ") << "\"" << Name(static_cast<Op>(i))
+          << "\": ";
+      PrintJson(out, stats.latency_ns[i]);
+    }
+    out << "}, \"nodes_per_find\": ";
+    PrintJson(out, stats.nodes_per_find);
+    out << "}";
+    separator = ", ";
+  }
+  out << "}\n";
+}
+
+inline std::string Json() {
+  std::ostringstream out;
+  PrintJson(out);
+  return out.str();
+}
+
+}  // namespace stats
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_STATS_H_
@@ -0,0 +1,661 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_UNROLLED_LIST_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_UNROLLED_LIST_H_
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "s21_alloc_stats.h"
+
+namespace s21 {
+
+// Doubly linked list of nodes that each hold up to B elements in place.
+// Inserting into a full node splits it in half. A node that erase leaves
+// under half full merges with a neighbour when their elements fit in one
+// node and borrows one from it otherwise, so insert and erase at an iterator
+// move at most B elements. Both invalidate iterators into the affected nodes.
+template <typename T, std::size_t B = 16,
+          class Allocator = DefaultAllocator<T, alloc_stats::UnrolledListTag>>
+class UnrolledList {
+  static_assert(B >= 2, "s21::UnrolledList needs at least two slots per node");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  struct Node {
+    Node *prev_;
+    Node *next_;
+    size_type count_;
+    alignas(value_type) unsigned char storage_[B * sizeof(value_type)];
+
+    value_type *data() { return reinterpret_cast<value_type *>(storage_); }
+  };
+
+  class UnrolledListIterator {
+    friend UnrolledList;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    UnrolledListIterator() = default;
+
+    reference operator*() const { return node_->data()[index_]; }
+
+    pointer operator->() const { return node_->data() + index_; }
+
+    UnrolledListIterator &operator++() {
+      if (++index_ == node_->count_) {
+        node_ = node_->next_;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    UnrolledListIterator operator++(int) {
+      UnrolledListIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    UnrolledListIterator &operator--() {
+      if (node_ == nullptr) {
+        node_ = list_->tail_;
+        index_ = node_->count_ - 1;
+      } else if (index_ == 0) {
+        node_ = node_->prev_;
+        index_ = node_->count_ - 1;
+      } else {
+        --index_;
+      }
+      return *this;
+    }
+
+    UnrolledListIterator operator--(int) {
+      UnrolledListIterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const UnrolledListIterator &other) const {
+      return node_ == other.node_ && index_ == other.index_;
+    }
+
+    bool operator!=(const UnrolledListIterator &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    UnrolledListIterator(const UnrolledList *list, Node *node, size_type index)
+        : list_(list), node_(node), index_(index) {}
+
+    const UnrolledList *list_ = nullptr;
+    Node *node_ = nullptr;
+    size_type index_ = 0;
+  };
+
+  class UnrolledListConstIterator : public UnrolledListIterator {
+   public:
+    using reference = const T &;
+    using pointer = const T *;
+
+    UnrolledListConstIterator() : UnrolledListIterator() {}
+    UnrolledListConstIterator(const UnrolledListIterator &it)
+        : UnrolledListIterator(it) {}
+
+    const_reference operator*() const {
+      return UnrolledListIterator::operator*();
+    }
+
+    const value_type *operator->() const {
+      return UnrolledListIterator::operator->();
+    }
+  };
+
+  using iterator = UnrolledListIterator;
+  using const_iterator = UnrolledListConstIterator;
+
+  iterator begin() { return iterator(this, head_, 0); }
+  iterator end() { return iterator(this, nullptr, 0); }
+
+  const_iterator cbegin() const { return iterator(this, head_, 0); }
+  const_iterator cend() const { return iterator(this, nullptr, 0); }
+
+  UnrolledList() : UnrolledList(allocator_type()) {}
+
+  explicit UnrolledList(const allocator_type &alloc)
+      : size_(0), head_(nullptr), tail_(nullptr), alloc_(alloc) {}
+
+  UnrolledList(size_type n) : UnrolledList() {
+    for (size_type i = 0; i < n; ++i) push_back(value_type());
+  }
+
+  UnrolledList(std::initializer_list<value_type> const &items)
+      : UnrolledList() {
+    for (auto &item : items) push_back(item);
+  }
+
+  UnrolledList(const UnrolledList &l)
+      : UnrolledList(l, node_traits::select_on_container_copy_construction(
+                            l.alloc_)) {}
+
+  UnrolledList(const UnrolledList &l, const allocator_type &alloc)
+      : UnrolledList(alloc) {
+    for (auto it = l.cbegin(); it != l.cend(); ++it) push_back(*it);
+  }
+
+  UnrolledList(UnrolledList &&l) : UnrolledList(l.get_allocator()) {
+    swap(l);
+  }
+
+  // Takes the nodes only when alloc can free them.
+  UnrolledList(UnrolledList &&l, const allocator_type &alloc)
+      : UnrolledList(alloc) {
+    if (alloc_ == l.alloc_) {
+      swap(l);
+    } else {
+      for (auto &value : l) Emplace(end(), std::move(value));
+    }
+  }
+
+  ~UnrolledList() { clear(); }
+
+  UnrolledList &operator=(const UnrolledList &l) {
+    if (this != &l) {
+      if constexpr (node_traits::propagate_on_container_copy_assignment::
+                        value) {
+        if (alloc_ != l.alloc_) clear();
+        alloc_ = l.alloc_;
+      }
+      UnrolledList copy(l, get_allocator());
+      swap(copy);
+    }
+    return *this;
+  }
+
+  UnrolledList &operator=(UnrolledList &&l) {
+    if (this != &l) {
+      if (node_traits::propagate_on_container_move_assignment::value ||
+          alloc_ == l.alloc_) {
+        clear();
+        swap(l);
+      } else {
+        UnrolledList tmp(std::move(l), get_allocator());
+        swap(tmp);
+      }
+    }
+    return *this;
+  }
+
+  const_reference front() { return head_->data()[0]; }
+
+  const_reference back() { return tail_->data()[tail_->count_ - 1]; }
+
+  reference operator[](size_type index) {
+    Node *node = head_;
+    while (index >= node->count_) {
+      index -= node->count_;
+      node = node->next_;
+    }
+    return node->data()[index];
+  }
+
+  bool empty() { return size_ == 0; }
+
+  size_type size() { return size_; }
+
+  size_type max_size() {
+    return std::numeric_limits<size_type>::max() / sizeof(Node) * B / 2;
+  }
+
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
+  void clear() {
+    while (head_ != nullptr) {
+      Node *next = head_->next_;
+      FreeNode(head_);
+      head_ = next;
+    }
+    tail_ = nullptr;
+    size_ = 0;
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    return Emplace(pos, value);
+  }
+
+  iterator insert(iterator pos, value_type &&value) {
+    return Emplace(pos, std::move(value));
+  }
+
+  // Returns the iterator following the erased element. The next node is
+  // tried first, then the previous one.
+  iterator erase(iterator pos) {
+    Node *node = pos.node_;
+    size_type index = pos.index_;
+    value_type *data = node->data();
+    std::move(data + index + 1, data + node->count_, data + index);
+    data[--node->count_].~value_type();
+    --size_;
+    Node *next = node->next_;
+    Node *prev = node->prev_;
+    size_type count = node->count_;
+    if (count == 0) {
+      UnlinkNode(node);
+      FreeNode(node);
+      return iterator(this, next, 0);
+    }
+    if (count < B / 2 && next != nullptr) {
+      if (count + next->count_ <= B) {
+        MoveElements(next, 0, next->count_, node);
+        UnlinkNode(next);
+        FreeNode(next);
+      } else {
+        BorrowFirst(next, node);
+      }
+      return iterator(this, node, index);
+    }
+    if (count < B / 2 && prev != nullptr) {
+      if (prev->count_ + count <= B) {
+        size_type offset = prev->count_;
+        MoveElements(node, 0, count, prev);
+        UnlinkNode(node);
+        FreeNode(node);
+        if (index == count) return end();
+        return iterator(this, prev, offset + index);
+      }
+      BorrowLast(prev, node);
+      ++index;
+    }
+    if (index == node->count_) return iterator(this, next, 0);
+    return iterator(this, node, index);
+  }
+
+  void push_back(const_reference value) { Emplace(end(), value); }
+
+  void push_front(const_reference value) { Emplace(begin(), value); }
+
+  void pop_back() {
+    if (tail_ != nullptr) erase(iterator(this, tail_, tail_->count_ - 1));
+  }
+
+  void pop_front() {
+    if (head_ != nullptr) erase(begin());
+  }
+
+  void swap(UnrolledList &other) {
+    std::swap(size_, other.size_);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+  }
+
+  void merge(UnrolledList &other) { merge(other, std::less<value_type>()); }
+
+  // Relinks a whole node when all of it sorts before the next element of the
+  // other list and the merged tail is full, and otherwise moves elements one
+  // by one into nodes emptied along the way. Two spare nodes, allocated
+  // before either list changes, cover the partly consumed node of each
+  // list, so that is the only allocation. Like splice, it needs an equal
+  // allocator in other.
+  template <class Compare>
+  void merge(UnrolledList &other, Compare comp) {
+    if (this == &other || other.head_ == nullptr) return;
+    if (head_ == nullptr) {
+      splice(cend(), other);
+      return;
+    }
+    Node *spare = AllocateNode();
+    try {
+      spare->next_ = AllocateNode();
+    } catch (...) {
+      node_traits::deallocate(alloc_, spare, 1);
+      throw;
+    }
+    spare->next_->next_ = nullptr;
+
+    Cursor a{head_, 0};
+    Cursor b{other.head_, 0};
+    head_ = tail_ = nullptr;
+    while (a.node != nullptr && b.node != nullptr) {
+      bool from_other = comp(b.Value(), a.Value());
+      Cursor &from = from_other ? b : a;
+      const_reference next = from_other ? a.Value() : b.Value();
+      Node *node = from.node;
+      const_reference last = node->data()[node->count_ - 1];
+      bool tail_full = tail_ == nullptr || tail_->count_ == B;
+      if (from.index == 0 && tail_full &&
+          (from_other ? comp(last, next) : !comp(next, last))) {
+        from.node = node->next_;
+        Append(node);
+        continue;
+      }
+      if (tail_full) {
+        Node *empty = spare;
+        spare = spare->next_;
+        Append(empty);
+      }
+      value_type &value = node->data()[from.index];
+      ::new (static_cast<void *>(tail_->data() + tail_->count_))
+          value_type(std::move(value));
+      ++tail_->count_;
+      value.~value_type();
+      if (++from.index == node->count_) {
+        from.node = node->next_;
+        from.index = 0;
+        node->count_ = 0;
+        node->next_ = spare;
+        spare = node;
+      }
+    }
+    for (Cursor *rest : {&a, &b}) {
+      Node *node = rest->node;
+      if (node == nullptr) continue;
+      // Shifts what is left of a partly consumed node to its front.
+      value_type *data = node->data();
+      for (size_type i = rest->index; i < node->count_; ++i) {
+        ::new (static_cast<void *>(data + i - rest->index))
+            value_type(std::move(data[i]));
+        data[i].~value_type();
+      }
+      node->count_ -= rest->index;
+      while (node != nullptr) {
+        Node *next = node->next_;
+        Append(node);
+        node = next;
+      }
+    }
+    while (spare != nullptr) {
+      Node *next = spare->next_;
+      FreeNode(spare);
+      spare = next;
+    }
+    size_ += other.size_;
+    other.head_ = other.tail_ = nullptr;
+    other.size_ = 0;
+  }
+
+  // Links the nodes of other in front of pos; only the node holding pos may
+  // be split, so the cost is O(B) regardless of the list sizes.
+  void splice(const_iterator pos, UnrolledList &other) {
+    if (this == &other || other.head_ == nullptr) return;
+    Node *before = pos.node_;
+    if (before != nullptr && pos.index_ != 0) {
+      before = SplitNode(before, pos.index_);
+    }
+    Node *first = other.head_;
+    Node *last = other.tail_;
+    Node *prev = before != nullptr ? before->prev_ : tail_;
+    first->prev_ = prev;
+    last->next_ = before;
+    if (prev != nullptr)
+      prev->next_ = first;
+    else
+      head_ = first;
+    if (before != nullptr)
+      before->prev_ = last;
+    else
+      tail_ = last;
+    size_ += other.size_;
+    other.head_ = other.tail_ = nullptr;
+    other.size_ = 0;
+  }
+
+  void splice(const_iterator pos, UnrolledList &other, const_iterator it) {
+    const_iterator last = it;
+    ++last;
+    splice(pos, other, it, last);
+  }
+
+  // Elements live inside the nodes, so a partial splice moves the values of
+  // [first, last) into a temporary list and links that in.
+  void splice(const_iterator pos, UnrolledList &other, const_iterator first,
+              const_iterator last) {
+    size_type count = 0;
+    for (const_iterator it = first; it != last; ++it) ++count;
+    if (count == 0) return;
+    size_type pos_index = 0;
+    if (this == &other) {
+      pos_index = IndexOf(pos);
+      size_type first_index = IndexOf(first);
+      if (pos_index >= first_index && pos_index <= first_index + count) return;
+      if (pos_index > first_index) pos_index -= count;
+    }
+    UnrolledList moved(get_allocator());
+    iterator it = first;
+    for (size_type i = 0; i < count; ++i) {
+      moved.Emplace(moved.end(), std::move(*it));
+      it = other.erase(it);
+    }
+    splice(this == &other ? IteratorAt(pos_index) : iterator(pos), moved);
+  }
+
+  void reverse() {
+    for (Node *node = head_; node != nullptr; node = node->prev_) {
+      std::reverse(node->data(), node->data() + node->count_);
+      std::swap(node->prev_, node->next_);
+    }
+    std::swap(head_, tail_);
+  }
+
+  void unique() {
+    if (size_ < 2) return;
+    iterator it = begin();
+    iterator next = it;
+    ++next;
+    while (next != end()) {
+      if (*it == *next) {
+        next = erase(next);
+      } else {
+        it = next;
+        ++next;
+      }
+    }
+  }
+
+  void sort() { sort(std::less<value_type>()); }
+
+  // Sorts a contiguous copy of the elements, held in memory from the list's
+  // allocator, and moves them back in place.
+  template <class Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) return;
+    std::vector<value_type, value_allocator> buffer{value_allocator(alloc_)};
+    buffer.reserve(size_);
+    for (auto &value : *this) buffer.push_back(std::move(value));
+    std::stable_sort(buffer.begin(), buffer.end(), comp);
+    auto source = buffer.begin();
+    for (auto &value : *this) value = std::move(*source++);
+  }
+
+ private:
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  using value_allocator =
+      typename node_traits::template rebind_alloc<value_type>;
+
+  size_type size_;
+  Node *head_;
+  Node *tail_;
+  node_allocator alloc_;
+
+  // Read position in one of the lists being merged.
+  struct Cursor {
+    Node *node;
+    size_type index;
+
+    const_reference Value() const { return node->data()[index]; }
+  };
+
+  template <class... Args>
+  iterator Emplace(iterator pos, Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    Node *node = pos.node_;
+    size_type index = pos.index_;
+    if (node == nullptr) {
+      node = tail_;
+      if (node == nullptr || node->count_ == B) node = NewNode(nullptr);
+      index = node->count_;
+    } else if (node->count_ == B) {
+      if (index == 0 && node->prev_ != nullptr && node->prev_->count_ < B) {
+        node = node->prev_;
+        index = node->count_;
+      } else if (index == 0) {
+        node = NewNode(node);
+      } else {
+        Node *right = SplitNode(node, B / 2);
+        if (index > B / 2) {
+          node = right;
+          index -= B / 2;
+        }
+      }
+    }
+    value_type *data = node->data();
+    if (index == node->count_) {
+      ::new (static_cast<void *>(data + index)) value_type(std::move(value));
+    } else {
+      ::new (static_cast<void *>(data + node->count_))
+          value_type(std::move(data[node->count_ - 1]));
+      std::move_backward(data + index, data + node->count_ - 1,
+                         data + node->count_);
+      data[index] = std::move(value);
+    }
+    ++node->count_;
+    ++size_;
+    return iterator(this, node, index);
+  }
+
+  Node *AllocateNode() {
+    Node *node = node_traits::allocate(alloc_, 1);
+    ::new (static_cast<void *>(node)) Node;
+    node->count_ = 0;
+    return node;
+  }
+
+  // Allocates an empty node and links it in front of before (nullptr: back).
+  Node *NewNode(Node *before) {
+    Node *node = AllocateNode();
+    Node *prev = before != nullptr ? before->prev_ : tail_;
+    node->prev_ = prev;
+    node->next_ = before;
+    if (prev != nullptr)
+      prev->next_ = node;
+    else
+      head_ = node;
+    if (before != nullptr)
+      before->prev_ = node;
+    else
+      tail_ = node;
+    return node;
+  }
+
+  void FreeNode(Node *node) {
+    value_type *data = node->data();
+    for (size_type i = 0; i < node->count_; ++i) data[i].~value_type();
+    node->~Node();
+    node_traits::deallocate(alloc_, node, 1);
+  }
+
+  void Append(Node *node) {
+    node->prev_ = tail_;
+    node->next_ = nullptr;
+    if (tail_ != nullptr)
+      tail_->next_ = node;
+    else
+      head_ = node;
+    tail_ = node;
+  }
+
+  void UnlinkNode(Node *node) {
+    if (node->prev_ != nullptr)
+      node->prev_->next_ = node->next_;
+    else
+      head_ = node->next_;
+    if (node->next_ != nullptr)
+      node->next_->prev_ = node->prev_;
+    else
+      tail_ = node->prev_;
+  }
+
+  // Moves [from, to) of source to the end of target and destroys the moved
+  // from slots; the caller keeps source->count_ consistent.
+  static void MoveElements(Node *source, size_type from, size_type to,
+                           Node *target) {
+    value_type *src = source->data();
+    value_type *dst = target->data() + target->count_;
+    for (size_type i = from; i < to; ++i, ++dst) {
+      ::new (static_cast<void *>(dst)) value_type(std::move(src[i]));
+      src[i].~value_type();
+    }
+    target->count_ += to - from;
+    source->count_ = from;
+  }
+
+  // Moves the first element of source to the end of target.
+  static void BorrowFirst(Node *source, Node *target) {
+    value_type *src = source->data();
+    ::new (static_cast<void *>(target->data() + target->count_))
+        value_type(std::move(src[0]));
+    ++target->count_;
+    std::move(src + 1, src + source->count_, src);
+    src[--source->count_].~value_type();
+  }
+
+  // Moves the last element of source to the front of target, which must not
+  // be empty.
+  static void BorrowLast(Node *source, Node *target) {
+    value_type *dst = target->data();
+    value_type &last = source->data()[source->count_ - 1];
+    ::new (static_cast<void *>(dst + target->count_))
+        value_type(std::move(dst[target->count_ - 1]));
+    std::move_backward(dst, dst + target->count_ - 1, dst + target->count_);
+    dst[0] = std::move(last);
+    ++target->count_;
+    last.~value_type();
+    --source->count_;
+  }
+
+  // Moves the elements from index at onwards into a new node after node.
+  Node *SplitNode(Node *node, size_type at) {
+    Node *right = NewNode(node->next_);
+    MoveElements(node, at, node->count_, right);
+    return right;
+  }
+
+  size_type IndexOf(const_iterator pos) const {
+    if (pos.node_ == nullptr) return size_;
+    size_type index = pos.index_;
+    for (Node *node = head_; node != pos.node_; node = node->next_) {
+      index += node->count_;
+    }
+    return index;
+  }
+
+  iterator IteratorAt(size_type index) {
+    Node *node = head_;
+    while (node != nullptr && index >= node->count_) {
+      index -= node->count_;
+      node = node->next_;
+    }
+    return iterator(this, node, node != nullptr ? index : 0);
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_UNROLLED_LIST_H_
@@ -1,11 +1,21 @@
 #ifndef CPP2_S21_CONTAINERS_1_SRC_S21_VECTOR_H_
 #define CPP2_S21_CONTAINERS_1_SRC_S21_VECTOR_H_
 
+#include <algorithm>
+#include <initializer_list>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_alloc_stats.h"
+#include "s21_stats.h"
 
 namespace s21 {
 
-template <typename T>
+template <typename T,
+          class Allocator = DefaultAllocator<T, alloc_stats::VectorTag>>
 class Vector {
  public:
   using value_type = T;
@@ -14,59 +24,87 @@ class Vector {
   using iterator = T *;
   using const_iterator = const T *;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
-  Vector() {
-    this->size_ = 0;
-    this->capacity_ = 0;
-    this->array = nullptr;
-  }
+  Vector() : Vector(allocator_type()) {}
+
+  explicit Vector(const allocator_type &alloc)
+      : array(nullptr), size_(0), capacity_(0), alloc_(alloc) {}
+
+  Vector(size_type n) : Vector(n, allocator_type()) {}
 
-  Vector(size_type n) {
-    this->size_ = n;
-    this->capacity_ = n;
-    this->array = new value_type[n];
+  Vector(size_type n, const allocator_type &alloc) : Vector(alloc) {
+    Allocate(n);
+    for (; size_ < n; ++size_) traits::construct(alloc_, array + size_);
   }
 
-  Vector(std::initializer_list<value_type> const &items) {
-    size_ = items.size();
-    capacity_ = items.size();
-    array = new value_type[capacity_];
-    std::copy(items.begin(), items.end(), array);
+  Vector(std::initializer_list<value_type> const &items) : Vector() {
+    Allocate(items.size());
+    for (const_reference item : items) {
+      traits::construct(alloc_, array + size_, item);
+      ++size_;
+    }
   }
 
-  Vector(const Vector &v) {
-    size_ = v.size_;
-    capacity_ = v.capacity_;
-    array = new T[capacity_];
-    std::copy(v.array, v.array + v.size_, array);
+  Vector(const Vector &v)
+      : Vector(v, traits::select_on_container_copy_construction(v.alloc_)) {}
+
+  Vector(const Vector &v, const allocator_type &alloc) : Vector(alloc) {
+    Allocate(v.capacity_);
+    for (; size_ < v.size_; ++size_) {
+      traits::construct(alloc_, array + size_, v.array[size_]);
+    }
   }
 
-  Vector(Vector &&v) noexcept {
-    size_ = v.size_;
-    capacity_ = v.capacity_;
-    array = v.array;
+  Vector(Vector &&v) noexcept
+      : array(v.array),
+        size_(v.size_),
+        capacity_(v.capacity_),
+        alloc_(std::move(v.alloc_)) {
     v.size_ = 0;
     v.capacity_ = 0;
     v.array = nullptr;
   }
 
-  ~Vector() {
-    if (this->array) {
-      delete[] this->array;
+  // Takes the storage only when alloc can free it; otherwise moves the
+  // elements one by one.
+  Vector(Vector &&v, const allocator_type &alloc) : Vector(alloc) {
+    if (alloc_ == v.alloc_) {
+      swap(v);
+    } else {
+      Allocate(v.size_);
+      for (; size_ < v.size_; ++size_) {
+        traits::construct(alloc_, array + size_, std::move(v.array[size_]));
+      }
     }
-    this->array = nullptr;
-    this->size_ = this->capacity_ = 0;
   }
 
-  Vector &operator=(Vector &&v) noexcept {
+  ~Vector() { Release(); }
+
+  Vector &operator=(const Vector &v) {
     if (this != &v) {
-      delete[] array;
-      size_ = v.size_;
-      capacity_ = v.capacity_;
-      array = v.array;
-      v.size_ = 0;
-      v.capacity_ = 0;
-      v.array = nullptr;
+      if constexpr (traits::propagate_on_container_copy_assignment::value) {
+        if (alloc_ != v.alloc_) Release();
+        alloc_ = v.alloc_;
+      }
+      Vector tmp(v, alloc_);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  Vector &operator=(Vector &&v) noexcept(
+      traits::propagate_on_container_move_assignment::value ||
+      traits::is_always_equal::value) {
+    if (this != &v) {
+      if (traits::propagate_on_container_move_assignment::value ||
+          alloc_ == v.alloc_) {
+        Release();
+        swap(v);
+      } else {
+        Vector tmp(std::move(v), alloc_);
+        swap(tmp);
+      }
     }
     return *this;
   }
@@ -77,16 +115,14 @@ class Vector {
   }
 
   reference operator[](size_type pos) {
-    size_type less_zero = 0;
-    if (this->size() < pos || less_zero > pos) {
+    if (this->size() < pos) {
       throw std::out_of_range("Index out of range");
     }
     return array[pos];
   }
 
-  reference operator[](size_type pos) const {
-    size_type less_zero = 0;
-    if (this->size() < pos || less_zero > pos) {
+  const_reference operator[](size_type pos) const {
+    if (this->size() < pos) {
       throw std::out_of_range("Index out of range");
     }
     return array[pos];
@@ -97,11 +133,14 @@ class Vector {
   }
 
   const_reference back() {
-    return this->empty() ? std::out_of_range("Out of range") : array[size_ - 1];
+    return this->empty() ? throw std::out_of_range("Out of range")
+                         : array[size_ - 1];
   }
 
   value_type *data() { return array; }
 
+  const value_type *data() const { return array; }
+
  public:
   iterator begin() noexcept { return array; }
 
@@ -114,7 +153,7 @@ class Vector {
  public:
   bool empty() const { return size_ != 0 ? false : true; }
 
-  size_type size() { return size_; };
+  size_type size() const { return size_; };
 
   size_type max_size() {
     return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2u;
@@ -124,19 +163,7 @@ class Vector {
     if (size <= capacity_) {
       return;
     }
-
-    value_type *newArray = new value_type[size];
-
-    if (array != nullptr) {
-      for (size_type i = 0; i < size_; ++i) {
-        newArray[i] = array[i];
-      }
-
-      delete[] array;
-    }
-
-    array = newArray;
-    capacity_ = size;
+    Reallocate(size);
   }
 
   size_type capacity() const { return capacity_; }
@@ -147,99 +174,156 @@ class Vector {
     }
 
     if (size_ == 0) {
-      delete[] array;
-      array = nullptr;
-      capacity_ = 0;
+      Release();
     } else {
-      value_type *newArray = new value_type[size_];
-
-      for (size_type i = 0; i < size_; ++i) {
-        newArray[i] = array[i];
-      }
-
-      delete[] array;
-      array = newArray;
-      capacity_ = size_;
+      Reallocate(size_);
     }
   }
 
+  allocator_type get_allocator() const { return alloc_; }
+
  public:
-  void clear() {
-    this->size_ = 0;
-    this->capacity_ = 0;
-    this->array = {nullptr};
-  }
+  // Also gives the storage back.
+  void clear() { Release(); }
 
   iterator insert(iterator pos, const_reference value) {
     size_type index = pos - begin();
-
-    if (size_ == capacity_) {
-      size_type newCapacity = (capacity_ == 0) ? 1 : capacity_ * 2;
-      reserve(newCapacity);
-    }
-
-    if (index < size_) {
-      for (size_type i = size_; i > index; --i) {
-        array[i] = array[i - 1];
-      }
+    if (index >= size_) {
+      push_back(value);
+      return begin() + size_ - 1;
     }
 
-    array[index] = value;
+    value_type copy = value;
+    Grow();
+    traits::construct(alloc_, array + size_, std::move(array[size_ - 1]));
     ++size_;
+    std::move_backward(array + index, array + size_ - 2, array + size_ - 1);
+    array[index] = std::move(copy);
 
     return begin() + index;
   }
 
   void erase(iterator pos) {
     if (pos >= begin() && pos < end()) {
-      size_type index = pos - begin();
-
-      for (size_type i = index; i < size_ - 1; ++i) {
-        array[i] = array[i + 1];
-      }
-
-      --size_;
-
-      array[size_].~value_type();
+      std::move(pos + 1, end(), pos);
+      pop_back();
     }
   }
 
-  void push_back(const_reference value) {
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
     if (size_ == capacity_) {
-      size_type newCapacity = (capacity_ == 0) ? 1 : capacity_ * 2;
-      reserve(newCapacity);
+      // Built first, as args may refer to an element about to move.
+      value_type value(std::forward<Args>(args)...);
+      Grow();
+      traits::construct(alloc_, array + size_, std::move(value));
+    } else {
+      traits::construct(alloc_, array + size_, std::forward<Args>(args)...);
     }
-
-    array[size_] = value;
-    ++size_;
+    return array[size_++];
   }
 
   void pop_back() {
     if (size_ > 0) {
-      --size_;
+      traits::destroy(alloc_, array + --size_);
     }
   }
 
   void swap(Vector &other) {
-    size_type tempSize = size_;
-    size_ = other.size_;
-    other.size_ = tempSize;
-
-    size_type tempCapacity = capacity_;
-    capacity_ = other.capacity_;
-    other.capacity_ = tempCapacity;
-
-    value_type *tempArray = array;
-    array = other.array;
-    other.array = tempArray;
+    std::swap(array, other.array);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    if constexpr (traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
   }
 
  private:
+  using traits = std::allocator_traits<Allocator>;
+
   value_type *array;
   size_type size_;
   size_type capacity_;
+  allocator_type alloc_;
+
+  // Storage for an empty vector with no storage yet.
+  void Allocate(size_type n) {
+    if (n != 0) array = traits::allocate(alloc_, n);
+    capacity_ = n;
+  }
+
+  void Grow() {
+    if (size_ == capacity_) Reallocate(capacity_ == 0 ? 1 : capacity_ * 2);
+  }
+
+  void Reallocate(size_type capacity) {
+    value_type *new_array = traits::allocate(alloc_, capacity);
+    size_type moved = 0;
+    try {
+      for (; moved < size_; ++moved) {
+        traits::construct(alloc_, new_array + moved,
+                          std::move_if_noexcept(array[moved]));
+      }
+    } catch (...) {
+      while (moved > 0) traits::destroy(alloc_, new_array + --moved);
+      traits::deallocate(alloc_, new_array, capacity);
+      throw;
+    }
+    stats::Count<alloc_stats::VectorTag>(stats::Counter::kReallocations);
+    stats::Count<alloc_stats::VectorTag>(stats::Counter::kBytesMoved,
+                                         size_ * sizeof(value_type));
+    size_type size = size_;
+    Release();
+    array = new_array;
+    size_ = size;
+    capacity_ = capacity;
+  }
+
+  // Destroys the elements and frees the storage; safe to call twice.
+  void Release() {
+    while (size_ > 0) traits::destroy(alloc_, array + --size_);
+    if (array != nullptr) traits::deallocate(alloc_, array, capacity_);
+    array = nullptr;
+    capacity_ = 0;
+  }
 };
 
+// Vectors on different allocators compare by their elements; Map needs these
+// to hold a Vector as its mapped value.
+template <class T, class A1, class A2>
+bool operator==(const Vector<T, A1> &a, const Vector<T, A2> &b) {
+  return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+}
+
+template <class T, class A1, class A2>
+bool operator!=(const Vector<T, A1> &a, const Vector<T, A2> &b) {
+  return !(a == b);
+}
+
+template <class T, class A1, class A2>
+bool operator<(const Vector<T, A1> &a, const Vector<T, A2> &b) {
+  return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+}
+
+template <class T, class A1, class A2>
+bool operator>(const Vector<T, A1> &a, const Vector<T, A2> &b) {
+  return b < a;
+}
+
+template <class T, class A1, class A2>
+bool operator<=(const Vector<T, A1> &a, const Vector<T, A2> &b) {
+  return !(b < a);
+}
+
+template <class T, class A1, class A2>
+bool operator>=(const Vector<T, A1> &a, const Vector<T, A2> &b) {
+  return !(a < b);
+}
+
 }  // namespace s21
 
 #endif  // CPP2_S21_CONTAINERS_1_SRC_S21_VECTOR_H_
@@ -0,0 +1,173 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_S21_WORK_STEALING_DEQUE_H_
+#define CPP2_S21_CONTAINERS_1_SRC_S21_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_epoch.h"
+#include "s21_node_pool.h"
+
+namespace s21 {
+
+// Chase-Lev work-stealing deque, with the memory orders of Le, Pop, Cohen
+// and Zappa Nardelli. One owner thread pushes and pops at the bottom
+// without waiting; any number of thieves take from the top with one CAS.
+// The ring grows by doubling, and the owner hands the old ring to Epoch,
+// since a thief may still be reading from it.
+//
+// A thief reads a slot before it knows whether its CAS wins, so slots are
+// atomics and T must be trivially copyable; task pointers or indices are the
+// intended payload.
+//
+// push_bottom and pop_bottom belong to the owner; steal_top may be called
+// from any thread. size and empty are a snapshot.
+template <class T>
+class WorkStealingDeque {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "s21::WorkStealingDeque needs a trivially copyable T");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  // The capacity is rounded up to a power of two.
+  explicit WorkStealingDeque(size_type capacity = 64) {
+    if (capacity == 0) {
+      throw std::length_error(
+          "s21::WorkStealingDeque::capacity must be positive");
+    }
+    std::int64_t rounded = 1;
+    while (static_cast<size_type>(rounded) < capacity) rounded <<= 1;
+    buffer_.store(Buffer::Create(rounded), std::memory_order_relaxed);
+  }
+
+  WorkStealingDeque(const WorkStealingDeque &) = delete;
+
+  WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+  ~WorkStealingDeque() {
+    ::operator delete(buffer_.load(std::memory_order_relaxed));
+  }
+
+  size_type capacity() const {
+    return buffer_.load(std::memory_order_relaxed)->mask + 1;
+  }
+
+  size_type size() const {
+    std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  void push_bottom(const_reference value) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+    if (bottom - top > buffer->mask) buffer = Grow(buffer, top, bottom);
+    buffer->Put(bottom, value);
+    bottom_.store(bottom + 1, std::memory_order_release);
+  }
+
+  // Takes the newest element. Returns false when the deque is empty or a
+  // thief took the last element first.
+  bool pop_bottom(reference out) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+    // Publishing the claim and then reading top must not be reordered; a
+    // seq_cst store and load give the same guarantee as the fence in the
+    // paper.
+    bottom_.store(bottom, std::memory_order_seq_cst);
+    std::int64_t top = top_.load(std::memory_order_seq_cst);
+    if (top > bottom) {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return false;
+    }
+    T value = buffer->Get(bottom);
+    if (top == bottom) {
+      // The last element: race the thieves for it.
+      bool won = top_.compare_exchange_strong(top, top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      if (!won) return false;
+    }
+    out = value;
+    return true;
+  }
+
+  // Takes the oldest element. Returns false when the deque is empty or the
+  // CAS lost to another thief or the owner; callers usually try another
+  // victim.
+  bool steal_top(reference out) {
+    Epoch::Guard guard;
+    std::int64_t top = top_.load(std::memory_order_seq_cst);
+    std::int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+    if (top >= bottom) return false;
+    Buffer *buffer = buffer_.load(std::memory_order_acquire);
+    T value = buffer->Get(top);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    out = value;
+    return true;
+  }
+
+ private:
+  // A power-of-two ring of atomic slots stored right after the header.
+  struct alignas(std::int64_t) alignas(std::atomic<T>) Buffer {
+    std::int64_t mask;
+
+    static Buffer *Create(std::int64_t capacity) {
+      void *memory = ::operator new(sizeof(Buffer) +
+                                    capacity * sizeof(std::atomic<T>));
+      Buffer *buffer = ::new (memory) Buffer{capacity - 1};
+      for (std::int64_t i = 0; i < capacity; ++i) {
+        ::new (static_cast<void *>(buffer->Slots() + i)) std::atomic<T>();
+      }
+      return buffer;
+    }
+
+    static void Destroy(void *buffer) { ::operator delete(buffer); }
+
+    std::atomic<T> *Slots() {
+      return reinterpret_cast<std::atomic<T> *>(this + 1);
+    }
+
+    T Get(std::int64_t index) {
+      return Slots()[index & mask].load(std::memory_order_relaxed);
+    }
+
+    void Put(std::int64_t index, T value) {
+      Slots()[index & mask].store(value, std::memory_order_relaxed);
+    }
+  };
+
+  static_assert(std::is_trivially_destructible_v<std::atomic<T>>);
+
+  // Copies the live range into a ring twice the size and retires the old
+  // one.
+  Buffer *Grow(Buffer *old, std::int64_t top, std::int64_t bottom) {
+    Buffer *buffer = Buffer::Create((old->mask + 1) * 2);
+    for (std::int64_t i = top; i < bottom; ++i) buffer->Put(i, old->Get(i));
+    buffer_.store(buffer, std::memory_order_release);
+    Epoch::Retire(old, &Buffer::Destroy);
+    return buffer;
+  }
+
+  alignas(kCacheLineSize) std::atomic<std::int64_t> top_{0};
+  alignas(kCacheLineSize) std::atomic<std::int64_t> bottom_{0};
+  std::atomic<Buffer *> buffer_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_S21_WORK_STEALING_DEQUE_H_
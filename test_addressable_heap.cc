@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_addressable_heap.h"
+
+TEST(AddressableHeapTest, push_pop) {
+  s21::AddressableHeap<int> h;
+  EXPECT_TRUE(h.empty());
+  for (int value : {5, 1, 8, 3, 9, 2}) h.push(value);
+  EXPECT_EQ(h.size(), 6);
+  std::vector<int> drained;
+  while (!h.empty()) {
+    drained.push_back(h.top());
+    h.pop();
+  }
+  EXPECT_EQ(drained, std::vector<int>({9, 8, 5, 3, 2, 1}));
+  h.pop();
+  EXPECT_TRUE(h.empty());
+}
+
+TEST(AddressableHeapTest, change_keys) {
+  s21::AddressableHeap<int> h;
+  auto a = h.push(10);
+  auto b = h.push(20);
+  auto c = h.push(30);
+  EXPECT_EQ(h.top_handle(), c);
+
+  h.increase_key(a, 40);
+  EXPECT_EQ(h.top_handle(), a);
+  EXPECT_EQ(h[a], 40);
+
+  h.decrease_key(a, 5);
+  EXPECT_EQ(h.top_handle(), c);
+  h.update(b, 50);
+  EXPECT_EQ(h.top(), 50);
+  h.update(b, 1);
+  EXPECT_EQ(h.top(), 30);
+
+  EXPECT_THROW(h.increase_key(c, 0), std::invalid_argument);
+  EXPECT_THROW(h.decrease_key(c, 100), std::invalid_argument);
+  EXPECT_EQ(h[c], 30);
+}
+
+TEST(AddressableHeapTest, erase_and_stale_handles) {
+  s21::AddressableHeap<std::string> h;
+  auto x = h.push("x");
+  auto y = h.emplace(3, 'y');
+  auto z = h.push("z");
+  h.erase(z);
+  EXPECT_FALSE(h.contains(z));
+  EXPECT_THROW(h.erase(z), std::out_of_range);
+  EXPECT_THROW(h[z], std::out_of_range);
+  EXPECT_THROW(h.update(s21::AddressableHeap<std::string>::handle_type(), "a"),
+               std::out_of_range);
+  EXPECT_EQ(h.top(), "yyy");
+  h.pop();
+  EXPECT_FALSE(h.contains(y));
+  EXPECT_TRUE(h.contains(x));
+  EXPECT_EQ(h.top(), "x");
+  EXPECT_EQ(h.size(), 1);
+}
+
+TEST(AddressableHeapTest, stale_handle_across_reuse) {
+  s21::AddressableHeap<int> h;
+  auto a = h.push(1);
+  h.erase(a);
+  auto b = h.push(2);
+  EXPECT_NE(a, b);
+  EXPECT_FALSE(h.contains(a));
+  EXPECT_TRUE(h.contains(b));
+  EXPECT_THROW(h[a], std::out_of_range);
+  EXPECT_THROW(h.update(a, 10), std::out_of_range);
+  EXPECT_EQ(h[b], 2);
+
+  h.clear();
+  auto c = h.push(3);
+  EXPECT_FALSE(h.contains(b));
+  EXPECT_THROW(h.erase(b), std::out_of_range);
+  EXPECT_EQ(h.top_handle(), c);
+  EXPECT_EQ(h.size(), 1);
+}
+
+TEST(AddressableHeapTest, random_operations_match_multiset) {
+  std::mt19937 gen(7);
+  s21::AddressableHeap<int, std::less<int>, 3> h;
+  std::multiset<int> expected;
+  std::vector<std::pair<s21::AddressableHeap<int, std::less<int>, 3>::
+                            handle_type,
+                        int>>
+      live;
+  for (int step = 0; step < 20000; ++step) {
+    unsigned op = gen() % 5;
+    if (op <= 1 || live.empty()) {
+      int value = gen() % 1000;
+      live.push_back({h.push(value), value});
+      expected.insert(value);
+    } else if (op == 2) {
+      size_t i = gen() % live.size();
+      int value = gen() % 1000;
+      h.update(live[i].first, value);
+      expected.erase(expected.find(live[i].second));
+      expected.insert(value);
+      live[i].second = value;
+    } else if (op == 3) {
+      size_t i = gen() % live.size();
+      h.erase(live[i].first);
+      expected.erase(expected.find(live[i].second));
+      live[i] = live.back();
+      live.pop_back();
+    } else {
+      ASSERT_EQ(h.top(), *expected.rbegin());
+      auto top = h.top_handle();
+      for (size_t i = 0; i < live.size(); ++i) {
+        if (live[i].first == top) {
+          live[i] = live.back();
+          live.pop_back();
+          break;
+        }
+      }
+      h.pop();
+      expected.erase(std::prev(expected.end()));
+    }
+    ASSERT_EQ(h.size(), expected.size());
+  }
+}
+
+TEST(AddressableHeapTest, dijkstra) {
+  const int n = 200;
+  std::mt19937 gen(3);
+  std::vector<std::vector<std::pair<int, int>>> graph(n);
+  for (int u = 0; u < n; ++u) {
+    for (int k = 0; k < 6; ++k) graph[u].push_back({gen() % n, gen() % 100});
+  }
+  const int inf = std::numeric_limits<int>::max();
+
+  // Reference: lazy deletion with duplicate entries.
+  std::vector<int> expected(n, inf);
+  using Item = std::pair<int, int>;
+  std::priority_queue<Item, std::vector<Item>, std::greater<Item>> lazy;
+  expected[0] = 0;
+  lazy.push({0, 0});
+  while (!lazy.empty()) {
+    auto [d, u] = lazy.top();
+    lazy.pop();
+    if (d != expected[u]) continue;
+    for (auto [v, w] : graph[u]) {
+      if (d + w < expected[v]) {
+        expected[v] = d + w;
+        lazy.push({expected[v], v});
+      }
+    }
+  }
+
+  s21::AddressableHeap<Item, std::greater<Item>> h;
+  std::vector<s21::AddressableHeap<Item, std::greater<Item>>::handle_type>
+      handles(n);
+  std::vector<int> dist(n, inf);
+  dist[0] = 0;
+  handles[0] = h.push({0, 0});
+  size_t peak = 0;
+  while (!h.empty()) {
+    peak = std::max(peak, h.size());
+    int u = h.top().second;
+    h.pop();
+    for (auto [v, w] : graph[u]) {
+      if (dist[u] + w >= dist[v]) continue;
+      bool queued = dist[v] != inf && h.contains(handles[v]) &&
+                    h[handles[v]].second == v;
+      dist[v] = dist[u] + w;
+      if (queued) {
+        h.increase_key(handles[v], {dist[v], v});
+      } else {
+        handles[v] = h.push({dist[v], v});
+      }
+    }
+  }
+  EXPECT_EQ(dist, expected);
+  EXPECT_LE(peak, static_cast<size_t>(n));
+}
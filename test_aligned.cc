@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "s21_aligned.h"
+#include "s21_ring_buffer.h"
+
+namespace {
+
+bool IsAligned(const void *ptr, size_t align) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % align == 0;
+}
+
+// Sums in steps of one 32-byte vector of floats with no remainder loop, as
+// a SIMD kernel would; relies on the padding being zero.
+template <class Array>
+float BlockSum(const Array &a) {
+  constexpr size_t kWidth = 32 / sizeof(float);
+  float lanes[kWidth] = {};
+  for (size_t i = 0; i < a.padded_size(); i += kWidth) {
+    for (size_t lane = 0; lane < kWidth; ++lane) lanes[lane] += a[i + lane];
+  }
+  return std::accumulate(lanes, lanes + kWidth, 0.0f);
+}
+
+}  // namespace
+
+static_assert(s21::AlignedArray<float, 13, 32>::kPaddedSize == 16);
+static_assert(s21::AlignedArray<char, 1>::kPaddedSize == 64);
+static_assert(alignof(s21::AlignedArray<double, 3>) == 64);
+
+TEST(AlignedTest, array_alignment_and_padding) {
+  s21::AlignedArray<float, 13, 32> a;
+  a.fill(1.5f);
+  s21::AlignedArray<float, 13, 32> b = {1, 2, 3};
+  EXPECT_TRUE(IsAligned(a.data(), 32));
+  EXPECT_TRUE(IsAligned(b.data(), 32));
+  EXPECT_EQ(a.size(), 13);
+  EXPECT_EQ(a.end() - a.begin(), 13);
+  EXPECT_EQ(a.padded_size(), 16);
+  EXPECT_FLOAT_EQ(BlockSum(a), 13 * 1.5f);
+  EXPECT_FLOAT_EQ(BlockSum(b), 6.0f);
+  EXPECT_THROW(a.at(13), std::out_of_range);
+  EXPECT_THROW((s21::AlignedArray<int, 2>{1, 2, 3}), std::out_of_range);
+
+  auto heap = std::make_unique<s21::AlignedArray<double, 5>>();
+  EXPECT_TRUE(IsAligned(heap->data(), 64));
+  a.swap(b);
+  EXPECT_FLOAT_EQ(a[2], 3.0f);
+  EXPECT_FLOAT_EQ(b.back(), 1.5f);
+}
+
+TEST(AlignedTest, vector_keeps_alignment_while_growing) {
+  s21::AlignedVector<float> v;
+  EXPECT_EQ(v.data(), nullptr);
+  for (int i = 0; i < 1000; ++i) {
+    v.push_back(static_cast<float>(i));
+    ASSERT_TRUE(IsAligned(v.data(), 64));
+  }
+  EXPECT_FLOAT_EQ(v[999], 999.0f);
+  v.shrink_to_fit();
+  EXPECT_TRUE(IsAligned(v.data(), 64));
+  s21::AlignedVector<float> copy = v;
+  EXPECT_TRUE(IsAligned(copy.data(), 64));
+  EXPECT_EQ(copy.size(), 1000);
+
+  s21::AlignedVector<std::string, 32> strings = {"a", "b"};
+  strings.insert(strings.begin() + 1, "c");
+  EXPECT_TRUE(IsAligned(strings.data(), 32));
+  EXPECT_EQ(strings[1], "c");
+}
+
+TEST(AlignedTest, allocator_with_other_containers) {
+  std::vector<int, s21::AlignedAllocator<int, 32>> std_vector(100, 7);
+  EXPECT_TRUE(IsAligned(std_vector.data(), 32));
+
+  s21::RingBuffer<double, s21::AlignedAllocator<double>> ring(10);
+  ring.push_back(1.0);
+  EXPECT_TRUE(IsAligned(&ring.front(), 64));
+  EXPECT_TRUE(s21::AlignedAllocator<int>() ==
+              s21::AlignedAllocator<double>());
+}
@@ -0,0 +1,280 @@
+#include <gtest/gtest-spi.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "s21_alloc_budget.h"
+#include "s21_alloc_stats.h"
+#include "s21_deque.h"
+#include "s21_list.h"
+#include "s21_map.h"
+#include "s21_ring_buffer.h"
+#include "s21_set.h"
+#include "s21_spsc_queue.h"
+#include "s21_unrolled_list.h"
+#include "s21_vector.h"
+
+namespace {
+
+struct VectorTestTag {
+  static constexpr const char *kName = "test::Vector";
+};
+
+struct ListTestTag {
+  static constexpr const char *kName = "test::List";
+};
+
+struct MapTestTag {
+  static constexpr const char *kName = "test::Map";
+};
+
+struct SetTestTag {
+  static constexpr const char *kName = "test::Set";
+};
+
+struct RingBufferTestTag {
+  static constexpr const char *kName = "test::RingBuffer";
+};
+
+struct SpscQueueTestTag {
+  static constexpr const char *kName = "test::SpscQueue";
+};
+
+struct UnrolledListTestTag {
+  static constexpr const char *kName = "test::UnrolledList";
+};
+
+struct DequeTestTag {
+  static constexpr const char *kName = "test::Deque";
+};
+
+using TrackedVector =
+    s21::Vector<int, s21::TrackingAllocator<int, VectorTestTag>>;
+using TrackedList = s21::List<int, s21::TrackingAllocator<int, ListTestTag>>;
+using TrackedMap =
+    s21::Map<int, int,
+             s21::TrackingAllocator<std::pair<const int, int>, MapTestTag>>;
+
+}  // namespace
+
+TEST(AllocStatsTest, default_allocator) {
+#ifdef S21_TRACK_ALLOCATIONS
+  EXPECT_TRUE((std::is_same_v<
+               s21::Vector<int>::allocator_type,
+               s21::TrackingAllocator<int, s21::alloc_stats::VectorTag>>));
+#else
+  EXPECT_TRUE(
+      (std::is_same_v<s21::Vector<int>::allocator_type, std::allocator<int>>));
+#endif
+}
+
+TEST(AllocStatsTest, default_allocator_of_buffers) {
+#ifdef S21_TRACK_ALLOCATIONS
+  EXPECT_TRUE((std::is_same_v<
+               s21::RingBuffer<int>::allocator_type,
+               s21::TrackingAllocator<int, s21::alloc_stats::RingBufferTag>>));
+  EXPECT_TRUE((std::is_same_v<
+               s21::SpscQueue<int>::allocator_type,
+               s21::TrackingAllocator<int, s21::alloc_stats::SpscQueueTag>>));
+  EXPECT_TRUE(
+      (std::is_same_v<
+          s21::UnrolledList<int>::allocator_type,
+          s21::TrackingAllocator<int, s21::alloc_stats::UnrolledListTag>>));
+#else
+  EXPECT_TRUE((std::is_same_v<s21::RingBuffer<int>::allocator_type,
+                              std::allocator<int>>));
+  EXPECT_TRUE((std::is_same_v<s21::SpscQueue<int>::allocator_type,
+                              std::allocator<int>>));
+  EXPECT_TRUE((std::is_same_v<s21::UnrolledList<int>::allocator_type,
+                              std::allocator<int>>));
+#endif
+}
+
+TEST(AllocStatsTest, vector_push_back) {
+  s21::AllocStats before = s21::alloc_stats::ForType("test::Vector");
+  {
+    TrackedVector v;
+    for (int i = 0; i < 100; ++i) v.push_back(i);
+    s21::AllocStats stats = s21::alloc_stats::ForInstance(v);
+    // Capacity doubles from 1 to 128.
+    EXPECT_EQ(stats.allocations, 8u);
+    EXPECT_EQ(stats.deallocations, 7u);
+    EXPECT_EQ(stats.live_bytes, static_cast<int64_t>(128 * sizeof(int)));
+    EXPECT_EQ(stats.peak_bytes,
+              static_cast<int64_t>((64 + 128) * sizeof(int)));
+    EXPECT_EQ(stats.bytes_allocated, 255 * sizeof(int));
+  }
+  s21::AllocStats after = s21::alloc_stats::ForType("test::Vector");
+  EXPECT_EQ(after.allocations - before.allocations, 8u);
+  EXPECT_EQ(after.deallocations - before.deallocations, 8u);
+  EXPECT_EQ(after.live_bytes, before.live_bytes);
+}
+
+TEST(AllocStatsTest, map_subscript) {
+  TrackedMap m;
+  // The tree allocates its end node up front.
+  EXPECT_EQ(s21::alloc_stats::ForInstance(m).allocations, 1u);
+  m[1] = 10;
+  m[2] = 20;
+  EXPECT_EQ(s21::alloc_stats::ForInstance(m).allocations, 3u);
+  m[1] = 11;
+  EXPECT_EQ(m[2], 20);
+  EXPECT_EQ(s21::alloc_stats::ForInstance(m).allocations, 3u);
+}
+
+TEST(AllocStatsTest, list_merge_does_not_allocate) {
+  TrackedList a;
+  TrackedList b;
+  for (int i = 0; i < 10; ++i) {
+    a.push_back(2 * i);
+    b.push_back(2 * i + 1);
+  }
+  s21::AllocStats before = s21::alloc_stats::ForType("test::List");
+  a.merge(b);
+  s21::AllocStats after = s21::alloc_stats::ForType("test::List");
+  EXPECT_EQ(a.size(), 20u);
+  EXPECT_EQ(after.allocations, before.allocations);
+  EXPECT_EQ(after.deallocations, before.deallocations);
+}
+
+TEST(AllocStatsTest, copy_and_move) {
+  TrackedVector v;
+  for (int i = 0; i < 4; ++i) v.push_back(i);
+  s21::AllocStats original = s21::alloc_stats::ForInstance(v);
+
+  TrackedVector copy(v);
+  s21::AllocStats copied = s21::alloc_stats::ForInstance(copy);
+  EXPECT_EQ(copied.allocations, 1u);
+  EXPECT_EQ(copied.live_bytes, static_cast<int64_t>(4 * sizeof(int)));
+
+  TrackedVector moved(std::move(v));
+  s21::AllocStats carried = s21::alloc_stats::ForInstance(moved);
+  EXPECT_EQ(carried.allocations, original.allocations);
+  EXPECT_EQ(carried.live_bytes, original.live_bytes);
+}
+
+TEST(AllocStatsTest, set_and_deque_types) {
+  s21::Set<int, s21::BinaryTree<int, std::less<int>,
+                                s21::TrackingAllocator<int, SetTestTag>>>
+      s{3, 1, 2};
+  EXPECT_EQ(s21::alloc_stats::ForInstance(s).allocations, 4u);
+  s21::Deque<int, s21::TrackingAllocator<int, DequeTestTag>> d;
+  d.push_back(1);
+  EXPECT_EQ(s21::alloc_stats::ForInstance(d).allocations, 2u);
+}
+
+TEST(AllocStatsTest, buffer_types) {
+  s21::RingBuffer<int, s21::TrackingAllocator<int, RingBufferTestTag>> r(4);
+  r.push_back(1);
+  EXPECT_EQ(s21::alloc_stats::ForInstance(r).allocations, 1u);
+  {
+    s21::SpscQueue<int, s21::TrackingAllocator<int, SpscQueueTestTag>> q(4);
+    q.push(1);
+    EXPECT_EQ(s21::alloc_stats::ForInstance(q).allocations, 1u);
+  }
+  EXPECT_EQ(s21::alloc_stats::ForType("test::SpscQueue").live_bytes, 0);
+  s21::UnrolledList<int, 4,
+                    s21::TrackingAllocator<int, UnrolledListTestTag>>
+      l{1, 2, 3, 4, 5};
+  s21::AllocStats stats = s21::alloc_stats::ForInstance(l);
+  EXPECT_GE(stats.allocations, 2u);
+  EXPECT_GT(stats.live_bytes, 0);
+}
+
+TEST(AllocStatsTest, report_and_reset) {
+  {
+    TrackedVector v{1, 2, 3};
+    bool found = false;
+    for (const auto &[name, stats] : s21::alloc_stats::Report()) {
+      if (name == "test::Vector") {
+        found = true;
+        EXPECT_GE(stats.allocations, 1u);
+        EXPECT_GE(stats.live_bytes, static_cast<int64_t>(3 * sizeof(int)));
+      }
+    }
+    EXPECT_TRUE(found);
+    EXPECT_GE(s21::alloc_stats::Total().allocations, 1u);
+    s21::alloc_stats::Reset();
+    s21::AllocStats reset = s21::alloc_stats::ForType("test::Vector");
+    // The vector's buffer is still live, so it counts as allocated.
+    EXPECT_EQ(reset.allocations, 1u);
+    EXPECT_EQ(reset.deallocations, 0u);
+    EXPECT_EQ(reset.live_bytes, static_cast<int64_t>(3 * sizeof(int)));
+    EXPECT_EQ(reset.peak_bytes, reset.live_bytes);
+  }
+  EXPECT_EQ(s21::alloc_stats::ForType("never::Used").allocations, 0u);
+  std::ostringstream out;
+  s21::alloc_stats::Print(out);
+  EXPECT_NE(out.str().find("test::Vector: 1 allocs, 1 frees"),
+            std::string::npos);
+  EXPECT_NE(out.str().find("total: "), std::string::npos);
+  EXPECT_EQ(out.str().find("never::Used"), std::string::npos);
+}
+
+namespace {
+
+// Runs body as a test watched by a listener of its own.
+template <class Body>
+void UnderListener(Body body) {
+  s21::AllocBudgetListener listener(s21::AllocBudget(), false);
+  const testing::TestInfo &info =
+      *testing::UnitTest::GetInstance()->current_test_info();
+  listener.OnTestStart(info);
+  body();
+  listener.OnTestEnd(info);
+  s21::SetAllocBudget(s21::AllocBudget());
+}
+
+void Leak() {
+  std::unique_ptr<TrackedVector> v;
+  UnderListener([&v] { v = std::make_unique<TrackedVector>(10); });
+}
+
+void OverAllocationBudget() {
+  UnderListener([] {
+    s21::AllocBudget budget;
+    budget.max_allocations = 2;
+    s21::SetAllocBudget(budget);
+    TrackedVector v;
+    for (int i = 0; i < 4; ++i) v.push_back(i);
+  });
+}
+
+void OverPeakBudget() {
+  UnderListener([] {
+    s21::AllocBudget budget;
+    budget.max_peak_bytes = 100 * sizeof(int);
+    s21::SetAllocBudget(budget);
+    TrackedVector v(1000);
+  });
+}
+
+}  // namespace
+
+TEST(AllocStatsTest, budget_listener) {
+  UnderListener([] {
+    s21::AllocBudget budget;
+    budget.max_allocations = 3;
+    budget.max_bytes = (1 + 2 + 4) * sizeof(int);
+    s21::SetAllocBudget(budget);
+    TrackedVector v;
+    for (int i = 0; i < 3; ++i) v.push_back(i);
+  });
+  EXPECT_NONFATAL_FAILURE(Leak(), "still allocated");
+  EXPECT_NONFATAL_FAILURE(OverAllocationBudget(), "allocation count");
+  EXPECT_NONFATAL_FAILURE(OverPeakBudget(), "peak bytes");
+
+  // Counts restarted by Reset() in the middle of a test are not compared
+  // with the ones from before it.
+  UnderListener([] {
+    s21::AllocBudget budget;
+    budget.max_allocations = 1;
+    s21::SetAllocBudget(budget);
+    TrackedVector v(10);
+    s21::alloc_stats::Reset();
+  });
+}
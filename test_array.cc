@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <functional>
 #include <list>
+#include <string>
 
 #include "s21_array.h"
 
@@ -104,3 +108,59 @@ TEST_F(TestArray, test_op_brck) {
 }
 
 TEST_F(TestArray, test_at) { EXPECT_EQ(array.at(3), test.at(3)); }
+
+namespace {
+
+constexpr s21::Array<int, 256> MakeSquares() {
+  s21::Array<int, 256> table{};
+  for (size_t i = 0; i < table.size(); ++i) table[i] = i * i;
+  return table;
+}
+
+constexpr s21::Array<int, 8> MakeSorted() {
+  s21::Array<int, 8> table = {5, -1, 9, 3, 3, 0, 12, 7};
+  s21::sort(table);
+  return table;
+}
+
+constexpr s21::Array<int, 256> kSquares = MakeSquares();
+constexpr s21::Array<int, 8> kSorted = MakeSorted();
+
+static_assert(sizeof(s21::Array<int, 5>) == 5 * sizeof(int));
+static_assert(kSquares[15] == 225 && kSquares.back() == 255 * 255);
+static_assert(kSorted == s21::Array<int, 8>{-1, 0, 3, 3, 5, 7, 9, 12});
+static_assert(kSorted < s21::Array<int, 8>{-1, 0, 3, 3, 5, 7, 9, 13});
+static_assert(s21::binary_search(kSorted, 7));
+static_assert(!s21::binary_search(kSorted, 8));
+static_assert(!s21::binary_search(kSorted, 100));
+static_assert(s21::accumulate(kSorted, 0) == 38);
+static_assert(s21::accumulate(kSorted, 1L, std::multiplies<>()) == 0);
+
+}  // namespace
+
+TEST_F(TestArray, test_constexpr_tables) {
+  EXPECT_EQ(kSquares.at(16), 256);
+  EXPECT_THROW(kSquares.at(256), std::out_of_range);
+  EXPECT_TRUE(std::is_sorted(kSorted.begin(), kSorted.end()));
+}
+
+TEST_F(TestArray, test_sort_matches_std) {
+  s21::Array<std::string, 6> words = {"pear", "fig", "apple",
+                                      "kiwi", "fig", "date"};
+  std::array<std::string, 6> expected = {"pear", "fig", "apple",
+                                         "kiwi", "fig", "date"};
+  s21::sort(words, std::greater<std::string>());
+  std::sort(expected.begin(), expected.end(), std::greater<std::string>());
+  EXPECT_TRUE(std::equal(words.begin(), words.end(), expected.begin()));
+  EXPECT_TRUE(
+      s21::binary_search(words, std::string("kiwi"), std::greater<>()));
+  EXPECT_EQ(s21::accumulate(words, std::string()), "pearkiwifigfigdateapple");
+}
+
+TEST_F(TestArray, test_compare) {
+  EXPECT_TRUE(array == array_3);
+  EXPECT_TRUE(array != array_2);
+  EXPECT_TRUE(array < array_2);
+  EXPECT_TRUE(array_2 >= array);
+  EXPECT_TRUE((array_empty == s21::Array<int, 0>()));
+}
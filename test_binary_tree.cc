@@ -60,3 +60,36 @@ TEST(BinaryTreeTest5, MoveAssignmentOperator) {
   EXPECT_EQ(binaryTree_copy.FindNode(5)->val, 5);
   ASSERT_TRUE(binaryTree_copy.FindNode(0) == nullptr);
 }
+
+TEST(BinaryTreeTest6, EraseMaxWithLeftChild) {
+  s21::BinaryTree<int> binaryTree({5, 3, 9, 7, 8});
+  binaryTree.erase(binaryTree.find(9));
+
+  int expected[] = {3, 5, 7, 8};
+  size_t i = 0;
+  for (const auto &value : binaryTree) EXPECT_EQ(value, expected[i++]);
+  EXPECT_EQ(i, 4);
+  EXPECT_EQ(binaryTree.size(), 4);
+
+  binaryTree.erase(binaryTree.find(5));
+  binaryTree.erase(binaryTree.find(3));
+  binaryTree.erase(binaryTree.find(8));
+  binaryTree.erase(binaryTree.find(7));
+  EXPECT_TRUE(binaryTree.empty());
+  binaryTree.insert(1);
+  EXPECT_EQ(*binaryTree.begin(), 1);
+}
+
+TEST(BinaryTreeTest7, CopyIsIndependent) {
+  s21::BinaryTree<int> binaryTree({4, 2, 6, 1, 3, 5});
+  s21::BinaryTree<int> binaryTree_copy(binaryTree);
+  binaryTree.clear();
+
+  int expected = 1;
+  for (const auto &value : binaryTree_copy) EXPECT_EQ(value, expected++);
+  EXPECT_EQ(expected, 7);
+
+  s21::BinaryTree<int> empty;
+  s21::BinaryTree<int> empty_copy(empty);
+  EXPECT_TRUE(empty_copy.empty());
+}
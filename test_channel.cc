@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_channel.h"
+#include "s21_ring_buffer.h"
+
+using namespace std::chrono_literals;
+
+TEST(ChannelTest, push_pop_and_close) {
+  s21::Channel<std::string> ch;
+  EXPECT_EQ(ch.capacity(), 0);
+  EXPECT_TRUE(ch.push("a"));
+  std::string b = "b";
+  EXPECT_TRUE(ch.push(b));
+  EXPECT_EQ(ch.size(), 2);
+
+  std::string value;
+  EXPECT_TRUE(ch.pop(value));
+  EXPECT_EQ(value, "a");
+  ch.close();
+  EXPECT_TRUE(ch.closed());
+  EXPECT_FALSE(ch.push("c"));
+  EXPECT_TRUE(ch.try_pop(value));
+  EXPECT_EQ(value, "b");
+  EXPECT_FALSE(ch.pop(value));
+  EXPECT_FALSE(ch.try_pop(value));
+  EXPECT_TRUE(ch.empty());
+}
+
+TEST(ChannelTest, move_only_elements) {
+  s21::Channel<std::unique_ptr<int>> ch;
+  ch.push(std::make_unique<int>(7));
+  std::unique_ptr<int> out;
+  EXPECT_TRUE(ch.pop(out));
+  EXPECT_EQ(*out, 7);
+}
+
+TEST(ChannelTest, pop_for_times_out) {
+  s21::Channel<int> ch;
+  int value = 0;
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_FALSE(ch.pop_for(value, 20ms));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+
+  std::thread producer([&ch] {
+    std::this_thread::sleep_for(10ms);
+    ch.push(42);
+  });
+  EXPECT_TRUE(ch.pop_for(value, 10s));
+  EXPECT_EQ(value, 42);
+  producer.join();
+}
+
+TEST(ChannelTest, bounded_backpressure) {
+  s21::Channel<int, s21::RingBuffer<int>> ch(2);
+  EXPECT_TRUE(ch.try_push(1));
+  EXPECT_TRUE(ch.try_push(2));
+  EXPECT_FALSE(ch.try_push(3));
+
+  std::thread producer([&ch] {
+    for (int i = 3; i <= 100; ++i) ch.push(i);
+    ch.close();
+  });
+  std::vector<int> received;
+  int value;
+  while (ch.pop(value)) {
+    EXPECT_LE(ch.size(), 2);
+    received.push_back(value);
+  }
+  producer.join();
+  ASSERT_EQ(received.size(), 100);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(received[i], i + 1);
+}
+
+TEST(ChannelTest, close_wakes_blocked_threads) {
+  s21::Channel<int> full(1);
+  full.push(0);
+  s21::Channel<int> empty;
+  bool pushed = true, popped = true;
+  std::thread pusher([&] { pushed = full.push(1); });
+  std::thread popper([&] {
+    int value;
+    popped = empty.pop(value);
+  });
+  std::this_thread::sleep_for(10ms);
+  full.close();
+  empty.close();
+  pusher.join();
+  popper.join();
+  EXPECT_FALSE(pushed);
+  EXPECT_FALSE(popped);
+}
+
+TEST(ChannelTest, pop_all_batches) {
+  s21::Channel<int> ch(64);
+  const int producers = 3, per_producer = 5000;
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&ch] {
+      for (int i = 1; i <= per_producer; ++i) ch.push(i);
+    });
+  }
+  std::thread closer([&] {
+    for (auto &thread : threads) thread.join();
+    ch.close();
+  });
+  std::vector<int> batch;
+  long sum = 0;
+  size_t received = 0;
+  while (ch.pop_all(std::back_inserter(batch), 32) != 0) {
+    EXPECT_LE(batch.size(), 32);
+    for (int value : batch) sum += value;
+    received += batch.size();
+    batch.clear();
+  }
+  closer.join();
+  EXPECT_EQ(received, static_cast<size_t>(producers * per_producer));
+  EXPECT_EQ(sum, producers * (per_producer * (per_producer + 1L) / 2));
+}
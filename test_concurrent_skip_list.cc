@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_concurrent_skip_list.h"
+
+TEST(ConcurrentSkipListTest, set_basic) {
+  s21::ConcurrentSkipListSet<int> s = {5, 1, 3};
+  EXPECT_EQ(s.size(), 3);
+  EXPECT_FALSE(s.empty());
+  EXPECT_TRUE(s.insert(4).second);
+  EXPECT_FALSE(s.insert(3).second);
+  EXPECT_EQ(*s.insert(3).first, 3);
+  EXPECT_TRUE(s.contains(1));
+  EXPECT_FALSE(s.contains(2));
+  EXPECT_TRUE(s.find(2) == s.end());
+  EXPECT_EQ(*s.find(5), 5);
+
+  std::vector<int> values(s.begin(), s.end());
+  EXPECT_EQ(values, std::vector<int>({1, 3, 4, 5}));
+
+  EXPECT_EQ(s.erase(3), 1);
+  EXPECT_EQ(s.erase(3), 0);
+  s.erase(s.find(1));
+  EXPECT_EQ(s.size(), 2);
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.size(), 0);
+}
+
+TEST(ConcurrentSkipListTest, custom_compare) {
+  s21::ConcurrentSkipListSet<int, std::greater<int>> s = {1, 2, 3};
+  std::vector<int> values(s.begin(), s.end());
+  EXPECT_EQ(values, std::vector<int>({3, 2, 1}));
+  EXPECT_EQ(*s.lower_bound(5), 3);
+}
+
+TEST(ConcurrentSkipListTest, range_scan) {
+  s21::ConcurrentSkipListSet<int> s;
+  for (int i = 0; i < 100; i += 2) s.insert(i);
+  std::vector<int> range;
+  for (auto it = s.lower_bound(11); it != s.end() && *it < 20; ++it) {
+    range.push_back(*it);
+  }
+  EXPECT_EQ(range, std::vector<int>({12, 14, 16, 18}));
+  EXPECT_EQ(*s.lower_bound(12), 12);
+  EXPECT_EQ(*s.upper_bound(12), 14);
+  EXPECT_TRUE(s.lower_bound(99) == s.end());
+}
+
+TEST(ConcurrentSkipListTest, map) {
+  s21::ConcurrentSkipListMap<int, std::string> m = {{2, "two"}, {1, "one"}};
+  EXPECT_TRUE(m.insert(3, "three").second);
+  EXPECT_FALSE(m.insert(3, "drei").second);
+  EXPECT_EQ(m.at(3), "three");
+  EXPECT_THROW(m.at(4), std::out_of_range);
+  EXPECT_EQ(m.begin()->first, 1);
+  EXPECT_EQ(m.lower_bound(2)->second, "two");
+  EXPECT_EQ(m.erase(1), 1);
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_EQ(m.size(), 2);
+}
+
+TEST(ConcurrentSkipListTest, iterator_survives_erase) {
+  s21::ConcurrentSkipListSet<std::string> s = {"a", "b", "c"};
+  auto it = s.find("b");
+  s.erase("b");
+  EXPECT_EQ(*it, "b");
+  ++it;
+  EXPECT_EQ(*it, "c");
+  EXPECT_FALSE(s.contains("b"));
+}
+
+TEST(ConcurrentSkipListTest, concurrent_insert) {
+  s21::ConcurrentSkipListSet<int> s;
+  const int threads = 4, per_thread = 2000;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&s, t] {
+      for (int i = 0; i < per_thread; ++i) s.insert(i * threads + t);
+    });
+  }
+  for (auto &worker : workers) worker.join();
+  EXPECT_EQ(s.size(), threads * per_thread);
+  int expected = 0;
+  for (int value : s) EXPECT_EQ(value, expected++);
+  EXPECT_EQ(expected, threads * per_thread);
+}
+
+TEST(ConcurrentSkipListTest, concurrent_mixed) {
+  s21::ConcurrentSkipListMap<int, int> m;
+  const int keys = 512;
+  std::atomic<bool> stop(false);
+  std::vector<std::thread> writers;
+  for (int t = 0; t < 2; ++t) {
+    writers.emplace_back([&m, t] {
+      for (int round = 0; round < 20; ++round) {
+        for (int k = t; k < keys; k += 2) m.insert(k, k * 10);
+        for (int k = t; k < keys; k += 2) EXPECT_EQ(m.erase(k), 1);
+      }
+      for (int k = t; k < keys; k += 2) m.insert(k, k * 10);
+    });
+  }
+  std::thread reader([&m, &stop] {
+    while (!stop.load()) {
+      int last = -1;
+      for (auto it = m.lower_bound(0); it != m.end(); ++it) {
+        EXPECT_LT(last, it->first);
+        EXPECT_EQ(it->second, it->first * 10);
+        last = it->first;
+      }
+    }
+  });
+  for (auto &writer : writers) writer.join();
+  stop = true;
+  reader.join();
+
+  EXPECT_EQ(m.size(), keys);
+  for (int k = 0; k < keys; ++k) EXPECT_EQ(m.at(k), k * 10);
+  s21::Epoch::Collect();
+}
+
+TEST(ConcurrentSkipListTest, concurrent_erase_same_key) {
+  s21::ConcurrentSkipListSet<int> s;
+  for (int i = 0; i < 1000; ++i) s.insert(i);
+  std::atomic<int> erased(0);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; ++t) {
+    workers.emplace_back([&s, &erased] {
+      for (int i = 0; i < 1000; ++i) erased += s.erase(i);
+    });
+  }
+  for (auto &worker : workers) worker.join();
+  EXPECT_EQ(erased.load(), 1000);
+  EXPECT_TRUE(s.empty());
+}
+
+// Inserts race erases of the same few keys, so new nodes get linked next to
+// erased ones with the same key; under ASan a node retired while still
+// linked can show up as a use after free.
+TEST(ConcurrentSkipListTest, concurrent_reinsert_same_keys) {
+  s21::ConcurrentSkipListSet<int> s;
+  const int keys = 8;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; ++t) {
+    workers.emplace_back([&s, t, keys] {
+      for (int round = 0; round < 20000; ++round) {
+        int key = (round + t) % keys;
+        if ((round + t) % 2 == 0) {
+          s.insert(key);
+        } else {
+          s.erase(key);
+        }
+        for (int k : s) EXPECT_LT(k, keys);
+      }
+    });
+  }
+  for (auto &worker : workers) worker.join();
+  int last = -1;
+  for (int k : s) {
+    EXPECT_LT(last, k);
+    last = k;
+  }
+  s21::Epoch::Collect();
+}
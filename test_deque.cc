@@ -1,45 +1,51 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <deque>
+#include <string>
 
 #include "s21_deque.h"
 
 TEST(DequeTest1, deque) {
   s21::Deque<int> d;
   d.push_front(8);
-  EXPECT_EQ(d.begin(), 8);
+  EXPECT_EQ(d.front(), 8);
   d.push_front(9);
-  EXPECT_EQ(d.begin(), 9);
+  EXPECT_EQ(d.front(), 9);
 
-  EXPECT_EQ(d.pop_back()->val, 8);
-  EXPECT_EQ(d.pop_back()->val, 9);
+  EXPECT_EQ(d.back(), 8);
+  d.pop_back();
+  EXPECT_EQ(d.back(), 9);
+  d.pop_back();
+  EXPECT_TRUE(d.empty());
 
   d.push_back(1);
-  EXPECT_EQ(d.end(), 1);
+  EXPECT_EQ(d.back(), 1);
   d.push_back(2);
-  EXPECT_EQ(d.end(), 2);
+  EXPECT_EQ(d.back(), 2);
 }
 
 TEST(DequeTest2, deque) {
   s21::Deque<double> d = {1.2, 3.4, 5.6, 7.8, 9.0};
-  EXPECT_DOUBLE_EQ(d[2]->val, 5.6);
+  EXPECT_DOUBLE_EQ(d[2], 5.6);
   EXPECT_EQ(d.size(), 5);
   s21::Deque<double> d_copy = d;
 
   std::deque<double> real_deque({1.2, 3.4, 5.6, 7.8, 9.0});
   for (auto i = 0U; i < d_copy.size(); i++) {
-    EXPECT_DOUBLE_EQ(d_copy[i]->val, real_deque[i]);
+    EXPECT_DOUBLE_EQ(d_copy[i], real_deque[i]);
   }
 }
 
 TEST(DequeTest3, deque) {
   s21::Deque<int> d = {1, 2, 3, 4, 5, 6, 7, 8, 9};
-  EXPECT_EQ(d.pop_front()->val, 1);
+  EXPECT_EQ(d.front(), 1);
+  d.pop_front();
   s21::Deque<int> d_moved = std::move(d);
 
   std::deque<int> real_deque({2, 3, 4, 5, 6, 7, 8, 9});
   for (auto i = 0U; i < d_moved.size(); i++) {
-    EXPECT_DOUBLE_EQ(d_moved[i]->val, real_deque[i]);
+    EXPECT_DOUBLE_EQ(d_moved[i], real_deque[i]);
   }
 }
 
@@ -53,11 +59,11 @@ TEST(DequeTest4, deque) {
   real_deque1.swap(real_deque2);
 
   for (auto i = 0U; i < d1.size(); i++) {
-    EXPECT_DOUBLE_EQ(d1[i]->val, real_deque1[i]);
+    EXPECT_DOUBLE_EQ(d1[i], real_deque1[i]);
   }
 
   for (auto i = 0U; i < d2.size(); i++) {
-    EXPECT_DOUBLE_EQ(d2[i]->val, real_deque2[i]);
+    EXPECT_DOUBLE_EQ(d2[i], real_deque2[i]);
   }
 }
 
@@ -70,11 +76,87 @@ TEST(DequeTest5, deque) {
   std::deque<std::string> real_deque2 = real_deque1;
 
   for (auto i = 0U; i < d2.size(); i++) {
-    EXPECT_TRUE(d2[i]->val == real_deque2[i]);
+    EXPECT_TRUE(d2[i] == real_deque2[i]);
   }
 }
 
 TEST(DequeTest6, deque) {
   s21::Deque<int> d = {0};
-  EXPECT_EQ(d.pop_front()->val, 0);
+  EXPECT_EQ(d.front(), 0);
+  d.pop_front();
+  EXPECT_TRUE(d.empty());
+  d.pop_front();
+  EXPECT_EQ(d.size(), 0);
+}
+
+TEST(DequeTest7, deque) {
+  s21::Deque<int> d;
+  std::deque<int> real_deque;
+  for (int i = 0; i < 5000; ++i) {
+    if (i % 3 == 0) {
+      d.push_front(i);
+      real_deque.push_front(i);
+    } else {
+      d.push_back(i);
+      real_deque.push_back(i);
+    }
+  }
+  ASSERT_EQ(d.size(), real_deque.size());
+  for (auto i = 0U; i < d.size(); i++) EXPECT_EQ(d[i], real_deque[i]);
+  for (int i = 0; i < 2000; ++i) {
+    d.pop_front();
+    real_deque.pop_front();
+    d.pop_back();
+    real_deque.pop_back();
+  }
+  ASSERT_EQ(d.size(), real_deque.size());
+  EXPECT_TRUE(std::equal(d.begin(), d.end(), real_deque.begin()));
+  EXPECT_THROW(d.at(d.size()), std::out_of_range);
+}
+
+TEST(DequeTest8, deque) {
+  s21::Deque<int> d = {5, 3, 9, 1, 7};
+  EXPECT_EQ(d.end() - d.begin(), 5);
+  EXPECT_EQ(d.begin()[2], 9);
+  EXPECT_EQ(*(d.end() - 1), 7);
+  std::sort(d.begin(), d.end());
+  EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+  EXPECT_TRUE(std::binary_search(d.begin(), d.end(), 7));
+
+  const s21::Deque<int> &cd = d;
+  int sum = 0;
+  for (auto it = cd.cbegin(); it != cd.cend(); ++it) sum += *it;
+  EXPECT_EQ(sum, 25);
+}
+
+TEST(DequeTest9, deque) {
+  s21::Deque<std::string> d = {"middle"};
+  std::string &ref = d.front();
+  for (int i = 0; i < 1000; ++i) {
+    d.push_back(std::to_string(i));
+    d.push_front(std::to_string(-i));
+  }
+  EXPECT_EQ(ref, "middle");
+  EXPECT_EQ(&d[1000], &ref);
+
+  s21::Deque<std::string> copy;
+  copy = d;
+  EXPECT_EQ(copy.size(), 2001);
+  EXPECT_EQ(copy.back(), "999");
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+  copy.push_back("again");
+  EXPECT_EQ(copy.front(), "again");
+}
+
+TEST(DequeTest10, deque) {
+  s21::Deque<int> d;
+  for (int round = 0; round < 10000; ++round) {
+    d.push_back(round);
+    d.push_back(round);
+    d.pop_front();
+  }
+  EXPECT_EQ(d.size(), 10000);
+  EXPECT_EQ(d.front(), 5000);
+  EXPECT_EQ(d.back(), 9999);
 }
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "s21_intrusive.h"
+
+struct Task : s21::list_hook<>, s21::tree_hook<> {
+  static int copies;
+
+  explicit Task(int priority) : priority(priority) {}
+  Task(const Task &other) : priority(other.priority) { ++copies; }
+
+  bool operator<(const Task &other) const { return priority < other.priority; }
+
+  int priority;
+};
+
+int Task::copies = 0;
+
+struct ByPriorityDesc {
+  bool operator()(const Task &a, const Task &b) const {
+    return a.priority > b.priority;
+  }
+};
+
+class TestIntrusive : public testing::Test {
+ protected:
+  void SetUp() override {
+    for (int priority : {5, 3, 8, 1, 9, 2, 7}) tasks.emplace_back(priority);
+    Task::copies = 0;
+  }
+
+  std::vector<Task> tasks;
+};
+
+TEST_F(TestIntrusive, list_links_objects) {
+  s21::IntrusiveList<Task> list;
+  for (auto &task : tasks) list.push_back(task);
+  EXPECT_EQ(list.size(), tasks.size());
+  EXPECT_EQ(&list.front(), &tasks.front());
+  EXPECT_EQ(&list.back(), &tasks.back());
+
+  size_t i = 0;
+  for (auto &task : list) EXPECT_EQ(&task, &tasks[i++]);
+  EXPECT_EQ(Task::copies, 0);
+}
+
+TEST_F(TestIntrusive, list_remove) {
+  s21::IntrusiveList<Task> list;
+  for (auto &task : tasks) list.push_front(task);
+  list.remove(tasks[3]);
+  list.remove(tasks.front());
+  list.remove(tasks.back());
+  std::list<int> expected = {2, 9, 8, 3};
+  EXPECT_EQ(list.size(), expected.size());
+  auto it = list.begin();
+  for (int priority : expected) EXPECT_EQ((it++)->priority, priority);
+
+  list.pop_front();
+  list.pop_back();
+  EXPECT_EQ(list.front().priority, 9);
+  EXPECT_EQ(list.back().priority, 8);
+  list.insert(list.iterator_to(tasks[2]), tasks[0]);
+  EXPECT_EQ(list.back().priority, 8);
+  EXPECT_EQ((++list.begin())->priority, 5);
+}
+
+TEST_F(TestIntrusive, list_sort_merge_reverse) {
+  s21::IntrusiveList<Task> list;
+  s21::IntrusiveList<Task> other;
+  for (size_t i = 0; i < tasks.size(); ++i) {
+    if (i % 2)
+      list.push_back(tasks[i]);
+    else
+      other.push_back(tasks[i]);
+  }
+  list.sort();
+  other.sort();
+  list.merge(other);
+  EXPECT_TRUE(other.empty());
+  std::list<int> expected = {1, 2, 3, 5, 7, 8, 9};
+  auto it = list.begin();
+  for (int priority : expected) EXPECT_EQ((it++)->priority, priority);
+
+  list.reverse();
+  expected.reverse();
+  it = list.begin();
+  for (int priority : expected) EXPECT_EQ((it++)->priority, priority);
+
+  list.sort(ByPriorityDesc());
+  it = list.begin();
+  for (int priority : expected) EXPECT_EQ((it++)->priority, priority);
+  EXPECT_EQ(Task::copies, 0);
+}
+
+TEST_F(TestIntrusive, list_splice) {
+  s21::IntrusiveList<Task> a;
+  s21::IntrusiveList<Task> b;
+  a.push_back(tasks[0]);
+  a.push_back(tasks[1]);
+  b.push_back(tasks[2]);
+  b.push_back(tasks[3]);
+  a.splice(++a.begin(), b);
+  EXPECT_TRUE(b.empty());
+  std::list<int> expected = {5, 8, 1, 3};
+  auto it = a.begin();
+  for (int priority : expected) EXPECT_EQ((it++)->priority, priority);
+
+  b.splice(b.end(), a, a.iterator_to(tasks[2]));
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(&b.front(), &tasks[2]);
+}
+
+TEST_F(TestIntrusive, set_insert_find) {
+  s21::IntrusiveSet<Task> set;
+  for (auto &task : tasks) EXPECT_TRUE(set.insert(task).second);
+  Task duplicate(5);
+  auto result = set.insert(duplicate);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(&*result.first, &tasks[0]);
+  EXPECT_EQ(set.size(), tasks.size());
+
+  int previous = 0;
+  for (auto &task : set) {
+    EXPECT_LT(previous, task.priority);
+    previous = task.priority;
+  }
+  EXPECT_EQ(&*set.find(Task(7)), &tasks[6]);
+  EXPECT_FALSE(set.contains(Task(4)));
+  EXPECT_EQ(set.lower_bound(Task(4))->priority, 5);
+  EXPECT_TRUE(set.lower_bound(Task(10)) == set.end());
+  EXPECT_EQ(Task::copies, 0);
+}
+
+TEST_F(TestIntrusive, set_insert_linked_object) {
+  s21::IntrusiveSet<Task> set;
+  for (auto &task : tasks) set.insert(task);
+  // The root, an inner node and a leaf.
+  for (size_t i : {0, 2, 3}) {
+    auto result = set.insert(tasks[i]);
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(&*result.first, &tasks[i]);
+  }
+  EXPECT_EQ(set.size(), tasks.size());
+  std::set<int> expected;
+  for (auto &task : tasks) expected.insert(task.priority);
+  auto it = set.begin();
+  for (int priority : expected) EXPECT_EQ((it++)->priority, priority);
+  EXPECT_TRUE(it == set.end());
+
+  s21::IntrusiveSet<Task> other;
+  EXPECT_THROW(other.insert(tasks[2]), std::invalid_argument);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(&*set.find(Task(8)), &tasks[2]);
+}
+
+TEST_F(TestIntrusive, set_erase) {
+  s21::IntrusiveSet<Task> set;
+  std::set<int> expected;
+  for (auto &task : tasks) {
+    set.insert(task);
+    expected.insert(task.priority);
+  }
+  for (size_t i : {4, 0, 6, 2}) {
+    set.erase(tasks[i]);
+    expected.erase(tasks[i].priority);
+    EXPECT_EQ(set.size(), expected.size());
+    auto it = set.begin();
+    for (int priority : expected) EXPECT_EQ((it++)->priority, priority);
+    EXPECT_TRUE(it == set.end());
+  }
+  auto next = set.erase(set.find(Task(2)));
+  EXPECT_EQ(next->priority, 3);
+  EXPECT_EQ((--set.end())->priority, 3);
+  EXPECT_TRUE(set.erase(set.find(Task(3))) == set.end());
+  EXPECT_EQ((--set.end())->priority, 1);
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_TRUE(set.insert(tasks[1]).second);
+}
+
+TEST_F(TestIntrusive, list_and_set_together) {
+  s21::IntrusiveList<Task> queue;
+  s21::IntrusiveSet<Task, ByPriorityDesc> by_priority;
+  for (auto &task : tasks) {
+    queue.push_back(task);
+    by_priority.insert(task);
+  }
+  Task &top = *by_priority.begin();
+  EXPECT_EQ(top.priority, 9);
+  queue.remove(top);
+  by_priority.erase(top);
+  EXPECT_EQ(queue.size(), 6);
+  EXPECT_EQ(by_priority.begin()->priority, 8);
+}
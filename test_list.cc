@@ -145,3 +145,152 @@ TEST_F(Testlist, merge) {
     EXPECT_EQ(*it, test[i]);
   }
 }
+
+TEST_F(Testlist, sort_compare) {
+  test.sort(std::greater<int>());
+  list.sort(std::greater<int>());
+
+  std::list<int>::iterator it;
+  for (size_t i = 0; i < list.size(); i++) {
+    it = std::next(list.begin(), i);
+    EXPECT_EQ(*it, test[i]);
+  }
+  EXPECT_EQ(test.front(), 6);
+  EXPECT_EQ(test.back(), 1);
+}
+
+TEST_F(Testlist, sort_stable) {
+  s21::List<std::pair<int, int>> pairs;
+  std::list<std::pair<int, int>> std_pairs;
+  for (int i = 0; i < 1000; ++i) {
+    pairs.push_back({(i * 37) % 10, i});
+    std_pairs.push_back({(i * 37) % 10, i});
+  }
+  auto by_key = [](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+    return a.first < b.first;
+  };
+  pairs.sort(by_key);
+  std_pairs.sort(by_key);
+
+  auto it = pairs.begin();
+  for (auto &p : std_pairs) {
+    EXPECT_EQ(p, *it);
+    ++it;
+  }
+}
+
+TEST_F(Testlist, sort_large) {
+  s21::List<int> big;
+  std::list<int> std_big;
+  for (int i = 0; i < 100000; ++i) {
+    big.push_back((i * 7919) % 100003);
+    std_big.push_back((i * 7919) % 100003);
+  }
+  big.sort();
+  std_big.sort();
+  EXPECT_EQ(big.size(), std_big.size());
+  EXPECT_EQ(big.front(), std_big.front());
+  EXPECT_EQ(big.back(), std_big.back());
+
+  auto it = big.begin();
+  for (int value : std_big) {
+    EXPECT_EQ(value, *it);
+    ++it;
+  }
+  big.pop_back();
+  std_big.pop_back();
+  EXPECT_EQ(big.back(), std_big.back());
+}
+
+TEST_F(Testlist, splice_moves_nodes) {
+  int *first = &*test_2.begin();
+  test.splice(++test.begin(), test_2);
+  list.splice(++list.begin(), list_2);
+
+  EXPECT_TRUE(test_2.empty());
+  EXPECT_EQ(test_2.size(), 0);
+  EXPECT_EQ(test.size(), list.size());
+  EXPECT_EQ(&*++test.begin(), first);
+  std::list<int>::iterator it;
+  for (size_t i = 0; i < list.size(); i++) {
+    it = std::next(list.begin(), i);
+    EXPECT_EQ(*it, test[i]);
+  }
+  EXPECT_EQ(test.back(), 5);
+}
+
+TEST_F(Testlist, splice_element) {
+  auto from = ++test_2.begin();
+  int *node = &*from;
+  test.splice(test.end(), test_2, from);
+  list.splice(list.end(), list_2, ++list_2.begin());
+
+  EXPECT_EQ(test.size(), list.size());
+  EXPECT_EQ(test_2.size(), list_2.size());
+  EXPECT_EQ(&test.back(), node);
+  EXPECT_EQ(test.back(), list.back());
+  for (size_t i = 0; i < list_2.size(); i++) {
+    EXPECT_EQ(*std::next(list_2.begin(), i), test_2[i]);
+  }
+
+  auto last = test.begin();
+  for (size_t i = 1; i < test.size(); i++) ++last;
+  test.splice(test.begin(), test, last);
+  list.splice(list.begin(), list, --list.end());
+  for (size_t i = 0; i < list.size(); i++) {
+    EXPECT_EQ(*std::next(list.begin(), i), test[i]);
+  }
+}
+
+TEST_F(Testlist, splice_range) {
+  auto first = ++test_2.begin();
+  auto last = first;
+  ++last;
+  ++last;
+  test.splice(test.begin(), test_2, first, last);
+  list.splice(list.begin(), list_2, std::next(list_2.begin()),
+              std::next(list_2.begin(), 3));
+
+  EXPECT_EQ(test.size(), list.size());
+  EXPECT_EQ(test_2.size(), list_2.size());
+  for (size_t i = 0; i < list.size(); i++) {
+    EXPECT_EQ(*std::next(list.begin(), i), test[i]);
+  }
+  for (size_t i = 0; i < list_2.size(); i++) {
+    EXPECT_EQ(*std::next(list_2.begin(), i), test_2[i]);
+  }
+
+  test_2.splice(test_2.end(), test_2, test_2.begin(), ++test_2.begin());
+  list_2.splice(list_2.end(), list_2, list_2.begin(), ++list_2.begin());
+  for (size_t i = 0; i < list_2.size(); i++) {
+    EXPECT_EQ(*std::next(list_2.begin(), i), test_2[i]);
+  }
+}
+
+TEST_F(Testlist, merge_relinks) {
+  test.sort();
+  list.sort();
+  test_2.sort();
+  list_2.sort();
+  const int *node = &test_2.front();
+  test.merge(test_2);
+  list.merge(list_2);
+
+  EXPECT_TRUE(test_2.empty());
+  EXPECT_EQ(test.size(), list.size());
+  EXPECT_EQ(&*++test.begin(), node);
+  for (size_t i = 0; i < list.size(); i++) {
+    EXPECT_EQ(*std::next(list.begin(), i), test[i]);
+  }
+  test.pop_back();
+  EXPECT_EQ(test.back(), 5);
+}
+
+TEST_F(Testlist, merge_compare) {
+  s21::List<int> a = {9, 5, 1};
+  s21::List<int> b = {8, 4, 0};
+  a.merge(b, std::greater<int>());
+  int expected[] = {9, 8, 5, 4, 1, 0};
+  EXPECT_EQ(a.size(), 6);
+  for (size_t i = 0; i < a.size(); i++) EXPECT_EQ(a[i], expected[i]);
+}
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <map>
 
+#include "s21_alloc_budget.h"
 #include "s21_map.h"
 
 TEST(MapTest1, Constructor) {
@@ -176,5 +177,10 @@ TEST(MapTest9, insert_or_assign) {
 
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
+#ifdef S21_TRACK_ALLOCATIONS
+  // make alloc_test: every test must stay within the default budget.
+  ::testing::UnitTest::GetInstance()->listeners().Append(
+      new s21::AllocBudgetListener());
+#endif
   return RUN_ALL_TESTS();
 }
\ No newline at end of file
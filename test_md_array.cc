@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "s21_md_array.h"
+
+TEST(MdArrayTest, layout_right_offsets) {
+  s21::LayoutRight::Mapping<3> m(s21::md::MakeIndex(2, 3, 4));
+  EXPECT_EQ(m(s21::md::MakeIndex(0, 0, 0)), 0u);
+  EXPECT_EQ(m(s21::md::MakeIndex(0, 0, 1)), 1u);
+  EXPECT_EQ(m(s21::md::MakeIndex(0, 1, 0)), 4u);
+  EXPECT_EQ(m(s21::md::MakeIndex(1, 2, 3)), 23u);
+  EXPECT_EQ(m.stride(0), 12u);
+  EXPECT_EQ(m.stride(2), 1u);
+  EXPECT_EQ(m.required_span_size(), 24u);
+}
+
+TEST(MdArrayTest, layout_left_offsets) {
+  s21::LayoutLeft::Mapping<3> m(s21::md::MakeIndex(2, 3, 4));
+  EXPECT_EQ(m(s21::md::MakeIndex(1, 0, 0)), 1u);
+  EXPECT_EQ(m(s21::md::MakeIndex(0, 1, 0)), 2u);
+  EXPECT_EQ(m(s21::md::MakeIndex(0, 0, 1)), 6u);
+  EXPECT_EQ(m(s21::md::MakeIndex(1, 2, 3)), 23u);
+  EXPECT_EQ(m.stride(0), 1u);
+  EXPECT_EQ(m.stride(2), 6u);
+  EXPECT_EQ(m.required_span_size(), 24u);
+}
+
+TEST(MdArrayTest, span_over_vector) {
+  std::vector<int> data(12);
+  std::iota(data.begin(), data.end(), 0);
+  s21::MdSpan<int, 2> rows(data.data(), 3, 4);
+  s21::MdSpan<int, 2, s21::LayoutLeft> cols(data.data(), 4, 3);
+  EXPECT_EQ(rows.rank(), 2u);
+  EXPECT_EQ(rows.size(), 12u);
+  EXPECT_EQ(rows(2, 1), 9);
+  EXPECT_EQ(cols(1, 2), 9);
+  rows(0, 3) = 100;
+  EXPECT_EQ(data[3], 100);
+  EXPECT_EQ(rows.at(2, 3), 11);
+  EXPECT_THROW(rows.at(3, 0), std::out_of_range);
+  EXPECT_THROW(rows.at(0, 4), std::out_of_range);
+}
+
+TEST(MdArrayTest, tiled_is_bijection) {
+  s21::LayoutTiled<4, 3>::Mapping<2> m(s21::md::MakeIndex(10, 7));
+  EXPECT_EQ(m.tile_rows(), 3u);
+  EXPECT_EQ(m.tile_cols(), 3u);
+  EXPECT_EQ(m.required_span_size(), 9u * 12u);
+  std::vector<int> hits(m.required_span_size());
+  for (size_t i = 0; i < 10; ++i) {
+    for (size_t j = 0; j < 7; ++j) {
+      size_t offset = m(s21::md::MakeIndex(i, j));
+      ASSERT_LT(offset, hits.size());
+      ++hits[offset];
+    }
+  }
+  EXPECT_EQ(std::accumulate(hits.begin(), hits.end(), 0), 70);
+  for (int hit : hits) EXPECT_LE(hit, 1);
+  // The first tile is the first 12 slots, row-major.
+  EXPECT_EQ(m(s21::md::MakeIndex(0, 2)), 2u);
+  EXPECT_EQ(m(s21::md::MakeIndex(1, 0)), 3u);
+  EXPECT_EQ(m(s21::md::MakeIndex(0, 3)), 12u);
+}
+
+TEST(MdArrayTest, tile_view) {
+  s21::MdArray<int, 2, s21::LayoutTiled<2, 2>> a(4, 4);
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 4; ++j) a(i, j) = static_cast<int>(i * 10 + j);
+  }
+  s21::MdSpan<int, 2> t = s21::tile(a.view(), 1, 0);
+  EXPECT_EQ(t.extent(0), 2u);
+  EXPECT_EQ(t.extent(1), 2u);
+  EXPECT_EQ(t(0, 0), 20);
+  EXPECT_EQ(t(1, 1), 31);
+  t(0, 1) = -1;
+  EXPECT_EQ(a(2, 1), -1);
+  EXPECT_THROW(s21::tile(a.view(), 2, 0), std::out_of_range);
+}
+
+TEST(MdArrayTest, submdspan_block) {
+  s21::MdArray<int, 2> m(4, 5);
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 5; ++j) m(i, j) = static_cast<int>(i * 5 + j);
+  }
+  auto block = s21::submdspan(m.view(), s21::md::Range{1, 3},
+                              s21::md::Range{2, 5});
+  EXPECT_EQ(block.rank(), 2u);
+  EXPECT_EQ(block.extent(0), 2u);
+  EXPECT_EQ(block.extent(1), 3u);
+  EXPECT_EQ(block(0, 0), 7);
+  EXPECT_EQ(block(1, 2), 14);
+  block(1, 0) = 0;
+  EXPECT_EQ(m(2, 2), 0);
+  EXPECT_THROW(s21::submdspan(m.view(), s21::md::Range{3, 5}, s21::md::kAll),
+               std::out_of_range);
+  EXPECT_THROW(s21::submdspan(m.view(), 4, s21::md::kAll), std::out_of_range);
+}
+
+TEST(MdArrayTest, row_and_column_iteration) {
+  s21::MdArray<int, 2> m(4, 5);
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 5; ++j) m(i, j) = static_cast<int>(i * 5 + j);
+  }
+  auto row = s21::submdspan(m.view(), 2, s21::md::kAll);
+  auto col = s21::submdspan(m.view(), s21::md::kAll, 3);
+  EXPECT_EQ(row.rank(), 1u);
+  EXPECT_EQ(row.end() - row.begin(), 5);
+  EXPECT_EQ(std::accumulate(row.begin(), row.end(), 0), 10 + 11 + 12 + 13 + 14);
+  EXPECT_EQ(col.stride(0), 5u);
+  EXPECT_EQ(std::accumulate(col.begin(), col.end(), 0), 3 + 8 + 13 + 18);
+  std::vector<int> values(col.begin(), col.end());
+  EXPECT_EQ(values, (std::vector<int>{3, 8, 13, 18}));
+  EXPECT_EQ(col.begin()[2], 13);
+}
+
+TEST(MdArrayTest, md_array_const_and_at) {
+  s21::MdArray<double, 3> a(2, 3, 4);
+  EXPECT_EQ(a.size(), 24u);
+  EXPECT_EQ(a.extent(2), 4u);
+  a.at(1, 2, 3) = 1.5;
+  const s21::MdArray<double, 3> &c = a;
+  EXPECT_EQ(c(1, 2, 3), 1.5);
+  EXPECT_EQ(c.data()[23], 1.5);
+  EXPECT_EQ(c(0, 0, 0), 0.0);
+  EXPECT_THROW(a.at(2, 0, 0), std::out_of_range);
+}
+
+constexpr int TensorTrace() {
+  s21::Tensor<int, 3, 3> t;
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) t(i, j) = static_cast<int>(i * 3 + j);
+  }
+  return t(0, 0) + t(1, 1) + t(2, 2);
+}
+
+TEST(MdArrayTest, tensor_constexpr) {
+  static_assert(TensorTrace() == 12);
+  static_assert(s21::Tensor<float, 2, 3, 4>::size() == 24);
+  static_assert(s21::Tensor<float, 2, 3, 4>::extent(1) == 3);
+  static_assert(sizeof(s21::Tensor<float, 2, 3, 4>) == 24 * sizeof(float));
+  s21::BasicTensor<int, s21::LayoutLeft, 2, 3> t;
+  t(1, 2) = 7;
+  EXPECT_EQ(t.data()[5], 7);
+  EXPECT_EQ(t.view()(1, 2), 7);
+}
+
+TEST(MdArrayTest, blocked_transpose) {
+  const size_t n = 37, m = 23, kBlock = 8;
+  s21::MdArray<int, 2> a(n, m);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < m; ++j) a(i, j) = static_cast<int>(i * 1000 + j);
+  }
+  s21::MdArray<int, 2> naive(m, n), blocked(m, n);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < m; ++j) naive(j, i) = a(i, j);
+  }
+  for (size_t bi = 0; bi < n; bi += kBlock) {
+    for (size_t bj = 0; bj < m; bj += kBlock) {
+      size_t ei = bi + kBlock < n ? bi + kBlock : n;
+      size_t ej = bj + kBlock < m ? bj + kBlock : m;
+      auto src = s21::submdspan(a.view(), s21::md::Range{bi, ei},
+                                s21::md::Range{bj, ej});
+      auto dst = s21::submdspan(blocked.view(), s21::md::Range{bj, ej},
+                                s21::md::Range{bi, ei});
+      for (size_t i = 0; i < src.extent(0); ++i) {
+        for (size_t j = 0; j < src.extent(1); ++j) dst(j, i) = src(i, j);
+      }
+    }
+  }
+  for (size_t j = 0; j < m; ++j) {
+    for (size_t i = 0; i < n; ++i) ASSERT_EQ(blocked(j, i), naive(j, i));
+  }
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "s21_mmap_vector.h"
+
+struct Record {
+  int id;
+  double weight;
+};
+
+class TestMmapVector : public testing::Test {
+ protected:
+  std::string path = testing::TempDir() + "s21_mmap_vector.bin";
+
+  void SetUp() override { std::remove(path.c_str()); }
+
+  void TearDown() override { std::remove(path.c_str()); }
+};
+
+TEST_F(TestMmapVector, empty_file) {
+  s21::MmapVector<int> v(path);
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.size(), 0);
+  EXPECT_EQ(v.data(), nullptr);
+  EXPECT_THROW(v.front(), std::out_of_range);
+}
+
+TEST_F(TestMmapVector, push_back_and_reopen) {
+  {
+    s21::MmapVector<Record> v(path);
+    for (int i = 0; i < 1000; ++i) v.push_back({i, i * 0.5});
+    EXPECT_EQ(v.size(), 1000);
+    EXPECT_GE(v.capacity(), 1000);
+    v.sync();
+  }
+  s21::MmapVector<Record> v(path);
+  EXPECT_EQ(v.size(), 1000);
+  EXPECT_EQ(v.capacity(), 1000);
+  EXPECT_EQ(v[999].id, 999);
+  EXPECT_DOUBLE_EQ(v.back().weight, 499.5);
+}
+
+TEST_F(TestMmapVector, open_readonly) {
+  std::vector<int> raw = {5, 4, 3, 2, 1};
+  {
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char *>(raw.data()),
+              raw.size() * sizeof(int));
+  }
+  auto v = s21::MmapVector<int>::open_readonly(path);
+  EXPECT_TRUE(v.is_readonly());
+  v.advise(s21::MmapVector<int>::Advice::kSequential);
+  ASSERT_EQ(v.size(), raw.size());
+  size_t i = 0;
+  for (auto element : v) EXPECT_EQ(element, raw[i++]);
+  EXPECT_THROW(v.push_back(0), std::logic_error);
+  EXPECT_THROW(v.at(5), std::out_of_range);
+
+  // Stores land in a private copy and never reach the file.
+  v[0] = 42;
+  EXPECT_EQ(v[0], 42);
+  auto again = s21::MmapVector<int>::open_readonly(path);
+  EXPECT_EQ(again[0], 5);
+}
+
+TEST_F(TestMmapVector, open_partial_record) {
+  {
+    std::ofstream out(path, std::ios::binary);
+    out.write("123456789", 9);
+  }
+  EXPECT_THROW(s21::MmapVector<int> v(path), std::runtime_error);
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  EXPECT_EQ(in.tellg(), 9);
+}
+
+TEST_F(TestMmapVector, open_readonly_partial_record) {
+  {
+    std::ofstream out(path, std::ios::binary);
+    out.write("12345678901", 11);
+  }
+  EXPECT_THROW(s21::MmapVector<int>::open_readonly(path), std::runtime_error);
+}
+
+TEST_F(TestMmapVector, sync_trims_the_file) {
+  s21::MmapVector<int> v(path);
+  for (int i = 0; i < 5; ++i) v.push_back(i);
+  EXPECT_EQ(v.capacity(), 8);
+  v.sync();
+  auto reader = s21::MmapVector<int>::open_readonly(path);
+  ASSERT_EQ(reader.size(), 5);
+  EXPECT_EQ(reader.back(), 4);
+
+  // Writing after a sync grows the file again before touching it.
+  for (int i = 5; i < 8; ++i) v.push_back(i);
+  v.resize(12);
+  v[11] = 11;
+  v.sync(true);
+  EXPECT_EQ(s21::MmapVector<int>::open_readonly(path).size(), 12);
+  v.pop_back();
+  v.sync();
+  EXPECT_EQ(s21::MmapVector<int>::open_readonly(path).size(), 11);
+  v.push_back(11);
+  EXPECT_EQ(v.back(), 11);
+}
+
+TEST_F(TestMmapVector, open_readonly_missing) {
+  EXPECT_THROW(s21::MmapVector<int>::open_readonly(path), std::system_error);
+}
+
+TEST_F(TestMmapVector, reserve_resize_shrink) {
+  s21::MmapVector<int> v(path);
+  v.reserve(100);
+  EXPECT_EQ(v.capacity(), 100);
+  v.resize(10);
+  EXPECT_EQ(v.size(), 10);
+  EXPECT_EQ(v[9], 0);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 10);
+  v.pop_back();
+  v.advise(s21::MmapVector<int>::Advice::kRandom);
+  v.sync(true);
+  v.close();
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  EXPECT_EQ(static_cast<size_t>(in.tellg()), 9 * sizeof(int));
+}
+
+TEST_F(TestMmapVector, move) {
+  s21::MmapVector<int> v(path);
+  v.push_back(42);
+  s21::MmapVector<int> moved(std::move(v));
+  EXPECT_EQ(v.size(), 0);
+  EXPECT_FALSE(v.is_open());
+  EXPECT_EQ(moved.front(), 42);
+  s21::MmapVector<int> assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(assigned[0], 42);
+}
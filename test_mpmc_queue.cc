@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_mpmc_queue.h"
+
+TEST(MpmcQueueTest, push_pop) {
+  s21::MpmcQueue<std::string> q(3);
+  EXPECT_EQ(q.capacity(), 4);
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(q.try_push(std::to_string(i)));
+  EXPECT_FALSE(q.try_push("full"));
+  EXPECT_EQ(q.size(), 4);
+  std::string value;
+  for (int lap = 0; lap < 10; ++lap) {
+    EXPECT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, std::to_string(lap));
+    EXPECT_TRUE(q.try_emplace(std::to_string(lap + 4)));
+  }
+  EXPECT_EQ(q.size(), 4);
+  EXPECT_THROW(s21::MpmcQueue<int>(0), std::length_error);
+}
+
+TEST(MpmcQueueTest, empty_pop_and_leftovers) {
+  s21::MpmcQueue<std::string> q(1);
+  EXPECT_EQ(q.capacity(), 2);
+  std::string value;
+  EXPECT_FALSE(q.try_pop(value));
+  EXPECT_TRUE(q.empty());
+  q.try_push(std::string(100, 'x'));
+}
+
+TEST(MpmcQueueTest, many_producers_many_consumers) {
+  s21::MpmcQueue<int> q(64);
+  const int producers = 3, consumers = 3, per_producer = 20000;
+  std::atomic<long> sum(0);
+  std::atomic<int> received(0);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&q] {
+      for (int i = 1; i <= per_producer; ++i) {
+        while (!q.try_push(i)) std::this_thread::yield();
+      }
+    });
+  }
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&] {
+      int value;
+      while (received.load() < producers * per_producer) {
+        if (q.try_pop(value)) {
+          sum += value;
+          ++received;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(sum.load(), 1L * producers * per_producer * (per_producer + 1) / 2);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(MpmcQueueTest, blocking_wrapper) {
+  s21::BlockingMpmcQueue<int> q(4);
+  const int workers = 3, jobs = 5000;
+  std::atomic<long> sum(0);
+  std::vector<std::thread> threads;
+  for (int w = 0; w < workers; ++w) {
+    threads.emplace_back([&] {
+      for (int job = q.pop(); job >= 0; job = q.pop()) sum += job;
+    });
+  }
+  for (int i = 1; i <= jobs; ++i) q.push(i);
+  for (int w = 0; w < workers; ++w) q.push(-1);
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(sum.load(), 1L * jobs * (jobs + 1) / 2);
+
+  int value;
+  EXPECT_FALSE(q.try_pop(value));
+  EXPECT_TRUE(q.try_push(7));
+  EXPECT_TRUE(q.try_pop(value));
+  EXPECT_EQ(value, 7);
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_deque.h"
+#include "s21_list.h"
+#include "s21_node_pool.h"
+
+TEST(NodePoolTest, recycles_slots) {
+  s21::NodePool<24, 8> pool;
+  void *first = pool.allocate();
+  void *second = pool.allocate();
+  EXPECT_NE(first, second);
+  EXPECT_EQ(static_cast<char *>(second) - static_cast<char *>(first), 24);
+  EXPECT_EQ(pool.capacity(), 32);
+
+  pool.deallocate(first);
+  EXPECT_EQ(pool.allocate(), first);
+  pool.deallocate(second);
+  pool.deallocate(first);
+  EXPECT_EQ(pool.capacity(), 32);
+}
+
+TEST(NodePoolTest, cache_line_aligned_chunks) {
+  s21::NodePool<16, 8> pool;
+  void *slot = pool.allocate();
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(slot) % s21::kCacheLineSize, 0);
+  for (int i = 0; i < 100; ++i) pool.allocate();
+  EXPECT_EQ(pool.capacity(), 32 + 64 + 128);
+}
+
+TEST(NodePoolTest, list_with_pool) {
+  s21::List<int, s21::PoolAllocator<int>> test = {3, 1, 2};
+  std::list<int> list = {3, 1, 2};
+  for (int i = 0; i < 1000; ++i) {
+    test.push_back(i);
+    test.push_front(-i);
+    test.pop_back();
+    test.pop_front();
+  }
+  test.sort();
+  list.sort();
+  EXPECT_EQ(test.size(), list.size());
+  for (size_t i = 0; i < list.size(); i++) {
+    EXPECT_EQ(*std::next(list.begin(), i), test[i]);
+  }
+  test.erase(test.begin());
+  EXPECT_EQ(test.front(), 2);
+}
+
+TEST(NodePoolTest, list_splice_shared_pool) {
+  s21::PoolAllocator<int> alloc;
+  s21::List<int, s21::PoolAllocator<int>> a(alloc);
+  a.push_back(1);
+  s21::List<int, s21::PoolAllocator<int>> b(a.get_allocator());
+  b.push_back(2);
+  b.push_back(3);
+  a.splice(a.end(), b);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(a.back(), 3);
+}
+
+TEST(NodePoolTest, rebind_shares_pools) {
+  s21::PoolAllocator<int> ints;
+  s21::PoolAllocator<long> longs(ints);
+  s21::PoolAllocator<int> back(longs);
+  EXPECT_TRUE(ints == back);
+  EXPECT_EQ(&ints.pool(), &back.pool());
+  s21::PoolAllocator<int> other;
+  EXPECT_TRUE(ints != other);
+}
+
+TEST(NodePoolTest, deque_with_pool) {
+  s21::Deque<int, s21::PoolAllocator<int>> d = {1, 2, 3};
+  d.push_front(0);
+  d.push_back(4);
+  EXPECT_EQ(d.size(), 5);
+  EXPECT_EQ(d.front(), 0);
+  EXPECT_EQ(d.back(), 4);
+  d.pop_front();
+  d.pop_back();
+  EXPECT_EQ(d.front(), 1);
+  EXPECT_EQ(d.back(), 3);
+  s21::Deque<int, s21::PoolAllocator<int>> copy(d);
+  EXPECT_EQ(copy[1], 2);
+
+  // Blocks come from the pool for the block type, and a block released by a
+  // pop is handed out again by the next push that needs one.
+  using Block = s21::Deque<int, s21::PoolAllocator<int>>::block_type;
+  auto &pool = s21::PoolAllocator<Block>(d.get_allocator()).pool();
+  EXPECT_GT(pool.capacity(), 0u);
+  std::size_t misses = pool.misses();
+  std::size_t hits = pool.hits();
+  for (int i = 0; i < 1000; ++i) d.push_back(i);
+  while (d.size() > 2) d.pop_back();
+  for (int i = 0; i < 1000; ++i) d.push_back(i);
+  EXPECT_GT(pool.hits(), hits);
+  EXPECT_EQ(pool.misses(), misses);
+}
+
+TEST(NodePoolTest, copy_assign_propagates_the_pool) {
+  s21::List<int, s21::PoolAllocator<int>> source = {1, 2, 3};
+  s21::List<int, s21::PoolAllocator<int>> target = {4, 5};
+  ASSERT_TRUE(source.get_allocator() != target.get_allocator());
+  target = source;
+  EXPECT_TRUE(target.get_allocator() == source.get_allocator());
+  EXPECT_EQ(target.size(), 3);
+  EXPECT_EQ(target.back(), 3);
+
+  s21::Deque<int, s21::PoolAllocator<int>> d = {1, 2};
+  s21::Deque<int, s21::PoolAllocator<int>> e = {3};
+  e = d;
+  EXPECT_TRUE(e.get_allocator() == d.get_allocator());
+  EXPECT_EQ(e.size(), 2);
+  EXPECT_EQ(e[1], 2);
+}
+
+TEST(NodePoolTest, thread_local_pool) {
+  using Alloc = s21::ThreadLocalPoolAllocator<std::string>;
+  std::thread worker([] {
+    s21::List<std::string, Alloc> l;
+    for (int i = 0; i < 100; ++i) l.push_back(std::to_string(i));
+    EXPECT_EQ(l.back(), "99");
+  });
+  worker.join();
+  s21::Deque<std::string, Alloc> d = {"a", "b"};
+  EXPECT_EQ(d.back(), "b");
+}
+
+TEST(NodePoolTest, thread_local_pool_hand_off) {
+  using Alloc = s21::ThreadLocalPoolAllocator<std::string>;
+  // Built on a thread that has exited by the time the nodes are freed.
+  s21::List<std::string, Alloc> handed;
+  std::thread producer([&handed] {
+    s21::List<std::string, Alloc> l;
+    for (int i = 0; i < 100; ++i) l.push_back(std::to_string(i));
+    handed.swap(l);
+  });
+  producer.join();
+  ASSERT_EQ(handed.size(), 100);
+  EXPECT_EQ(handed.back(), "99");
+  handed.clear();
+
+  // Freed on another thread while the owner keeps allocating.
+  // Uses up the first chunk, so the second round is served only by the
+  // slots the other thread gave back.
+  s21::ThreadLocalPoolAllocator<long> alloc;
+  auto &pool = alloc.pool();
+  std::vector<long *> nodes = {alloc.allocate(1)};
+  size_t capacity = pool.capacity();
+  while (nodes.size() < capacity) nodes.push_back(alloc.allocate(1));
+  std::thread consumer([&alloc, &nodes] {
+    for (long *node : nodes) alloc.deallocate(node, 1);
+  });
+  consumer.join();
+  for (long *&node : nodes) node = alloc.allocate(1);
+  EXPECT_EQ(pool.capacity(), capacity);
+  for (long *node : nodes) alloc.deallocate(node, 1);
+}
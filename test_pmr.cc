@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <utility>
+
+#include "s21_pmr.h"
+
+namespace {
+
+// Counts what goes through it on the way to new/delete.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  int allocations = 0;
+  std::size_t live_bytes = 0;
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t align) override {
+    ++allocations;
+    live_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+
+  void do_deallocate(void *ptr, std::size_t bytes,
+                     std::size_t align) override {
+    live_bytes -= bytes;
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+  }
+
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+// Installs a CountingResource as the default resource for its lifetime.
+class DefaultResourceGuard {
+ public:
+  DefaultResourceGuard()
+      : previous_(std::pmr::set_default_resource(&resource)) {}
+  ~DefaultResourceGuard() { std::pmr::set_default_resource(previous_); }
+
+  CountingResource resource;
+
+ private:
+  std::pmr::memory_resource *previous_;
+};
+
+}  // namespace
+
+TEST(PmrTest, containers_allocate_from_their_resource) {
+  DefaultResourceGuard guard;
+  CountingResource res;
+  {
+    s21::pmr::Vector<int> v(&res);
+    s21::pmr::List<int> l(&res);
+    s21::pmr::Deque<int> d(&res);
+    s21::pmr::Set<int> s(&res);
+    s21::pmr::Map<int, int> m(&res);
+    for (int i = 0; i < 100; ++i) {
+      v.push_back(i);
+      l.push_back(i);
+      d.push_back(i);
+      s.insert(i);
+      m.insert(i, i);
+    }
+    EXPECT_EQ(v.get_allocator().resource(), &res);
+    EXPECT_EQ(l.get_allocator().resource(), &res);
+    EXPECT_EQ(d.get_allocator().resource(), &res);
+    EXPECT_EQ(s.get_allocator().resource(), &res);
+    EXPECT_EQ(m.get_allocator().resource(), &res);
+    EXPECT_GT(res.allocations, 0);
+    EXPECT_EQ(v[99] + l.back() + d[99] + m.at(99), 4 * 99);
+  }
+  EXPECT_EQ(res.live_bytes, 0u);
+  EXPECT_EQ(guard.resource.allocations, 0);
+}
+
+TEST(PmrTest, map_of_vectors_propagates_the_resource) {
+  DefaultResourceGuard guard;
+  CountingResource res;
+  {
+    s21::pmr::Map<int, s21::pmr::Vector<int>> m(&res);
+    for (int i = 0; i < 10; ++i) {
+      for (int j = 0; j <= i; ++j) m[i].push_back(j);
+    }
+    EXPECT_EQ(guard.resource.allocations, 0);
+    s21::pmr::Vector<int> v{1, 2, 3};
+    m.insert(10, v);
+    m.insert_or_assign(0, v);
+    for (int i = 0; i <= 10; ++i) {
+      EXPECT_EQ(m.at(i).get_allocator().resource(), &res);
+    }
+    EXPECT_EQ(m.at(9).size(), 10u);
+    EXPECT_EQ(m.at(0).size(), 3u);
+  }
+  EXPECT_EQ(res.live_bytes, 0u);
+}
+
+TEST(PmrTest, nested_sequences_propagate_the_resource) {
+  CountingResource res;
+  s21::pmr::List<s21::pmr::Vector<int>> l(&res);
+  s21::pmr::Deque<s21::pmr::Vector<int>> d(&res);
+  s21::pmr::Vector<s21::pmr::Vector<int>> v(&res);
+  s21::pmr::Vector<int> item{1, 2};
+  l.push_back(item);
+  d.push_back(item);
+  v.push_back(item);
+  v.emplace_back(3);
+  EXPECT_EQ(l.front().get_allocator().resource(), &res);
+  EXPECT_EQ(d[0].get_allocator().resource(), &res);
+  EXPECT_EQ(v[0].get_allocator().resource(), &res);
+  EXPECT_EQ(v[1].get_allocator().resource(), &res);
+  EXPECT_EQ(v[1].size(), 3u);
+}
+
+TEST(PmrTest, monotonic_arena) {
+  alignas(std::max_align_t) std::byte buffer[1 << 16];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  s21::pmr::Map<std::pmr::string, s21::pmr::Vector<int>> m(&arena);
+  for (int i = 0; i < 20; ++i) {
+    std::string key = "a request key long enough to allocate " +
+                      std::to_string(i);
+    m[std::pmr::string(key)].push_back(i);
+  }
+  int sum = 0;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    auto &[key, values] = it.get()->val;
+    EXPECT_EQ(key.get_allocator().resource(), &arena);
+    EXPECT_EQ(values.get_allocator().resource(), &arena);
+    sum += values[0];
+  }
+  EXPECT_EQ(sum, 190);
+}
+
+TEST(PmrTest, copy_and_move_across_resources) {
+  CountingResource a;
+  CountingResource b;
+  s21::pmr::Vector<int> v(&a);
+  for (int i = 0; i < 10; ++i) v.push_back(i);
+
+  s21::pmr::Vector<int> copy(v, &b);
+  EXPECT_EQ(copy.get_allocator().resource(), &b);
+  EXPECT_EQ(copy[9], 9);
+
+  s21::pmr::Vector<int> stolen(std::move(copy), &b);
+  EXPECT_EQ(stolen.size(), 10u);
+  EXPECT_EQ(copy.size(), 0u);
+
+  s21::pmr::Vector<int> moved(std::move(v), &b);
+  EXPECT_EQ(moved.get_allocator().resource(), &b);
+  EXPECT_EQ(moved[9], 9);
+
+  s21::pmr::Vector<int> assigned(&a);
+  assigned = std::move(moved);
+  EXPECT_EQ(assigned.get_allocator().resource(), &a);
+  EXPECT_EQ(assigned[9], 9);
+  assigned = stolen;
+  EXPECT_EQ(assigned.get_allocator().resource(), &a);
+
+  s21::pmr::List<int> l({1, 2, 3});
+  s21::pmr::List<int> l2(std::move(l), &b);
+  EXPECT_EQ(l2.get_allocator().resource(), &b);
+  EXPECT_EQ(l2.back(), 3);
+
+  s21::pmr::Deque<int> d(&a);
+  d.push_back(1);
+  s21::pmr::Deque<int> d2(&b);
+  d2 = std::move(d);
+  EXPECT_EQ(d2.get_allocator().resource(), &b);
+  EXPECT_EQ(d2[0], 1);
+
+  s21::pmr::Set<int> s(&a);
+  s.insert(1);
+  s21::pmr::Set<int> s2(std::move(s), &b);
+  EXPECT_EQ(s2.get_allocator().resource(), &b);
+  EXPECT_TRUE(s2.contains(1));
+
+  s21::pmr::Map<int, int> m(&a);
+  m.insert(1, 2);
+  s21::pmr::Map<int, int> m2(m, &b);
+  s21::pmr::Map<int, int> m3(std::move(m), &b);
+  EXPECT_EQ(m2.get_allocator().resource(), &b);
+  EXPECT_EQ(m2.at(1), 2);
+  EXPECT_EQ(m3.at(1), 2);
+}
+
+TEST(PmrTest, copy_assign_keeps_the_resource) {
+  CountingResource a;
+  CountingResource b;
+  {
+    s21::pmr::List<int> source(&a);
+    for (int i = 0; i < 3; ++i) source.push_back(i);
+    s21::pmr::List<int> target(&b);
+    for (int i = 0; i < 5; ++i) target.push_back(10 + i);
+
+    target = source;
+    EXPECT_EQ(target.get_allocator().resource(), &b);
+    EXPECT_EQ(target.size(), 3u);
+    EXPECT_EQ(target.front(), 0);
+    EXPECT_EQ(target.back(), 2);
+    target = target;
+    EXPECT_EQ(target.size(), 3u);
+    EXPECT_EQ(source.size(), 3u);
+
+    s21::pmr::Vector<int> v(&a);
+    v.push_back(1);
+    s21::pmr::Vector<int> w(&b);
+    w.push_back(2);
+    w.push_back(3);
+    w = v;
+    EXPECT_EQ(w.get_allocator().resource(), &b);
+    EXPECT_EQ(w.size(), 1u);
+    EXPECT_EQ(w[0], 1);
+  }
+  EXPECT_EQ(a.live_bytes, 0u);
+  EXPECT_EQ(b.live_bytes, 0u);
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "s21_deque.h"
+#include "s21_priority_queue.h"
+
+template <class Queue>
+std::vector<int> Drain(Queue &q) {
+  std::vector<int> result;
+  while (!q.empty()) {
+    result.push_back(q.top());
+    q.pop();
+  }
+  return result;
+}
+
+TEST(PriorityQueueTest, push_pop) {
+  s21::PriorityQueue<int> q;
+  EXPECT_TRUE(q.empty());
+  for (int value : {5, 1, 8, 3, 9, 2}) q.push(value);
+  EXPECT_EQ(q.size(), 6);
+  EXPECT_EQ(q.top(), 9);
+  EXPECT_EQ(Drain(q), std::vector<int>({9, 8, 5, 3, 2, 1}));
+  q.pop();
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(PriorityQueueTest, heapify_matches_std) {
+  std::mt19937 gen(42);
+  std::vector<int> values(1000);
+  for (int &value : values) value = gen() % 500;
+
+  s21::PriorityQueue<int> q(values.begin(), values.end());
+  std::priority_queue<int> expected(values.begin(), values.end());
+  ASSERT_EQ(q.size(), expected.size());
+  while (!expected.empty()) {
+    ASSERT_EQ(q.top(), expected.top());
+    q.pop();
+    expected.pop();
+  }
+}
+
+TEST(PriorityQueueTest, min_heap_and_arity) {
+  s21::PriorityQueue<int, s21::Vector<int>, std::greater<int>, 2> binary = {
+      4, 7, 1, 9, 3};
+  EXPECT_EQ(Drain(binary), std::vector<int>({1, 3, 4, 7, 9}));
+
+  s21::PriorityQueue<int, s21::Vector<int>, std::less<int>, 8> wide;
+  for (int i = 0; i < 100; ++i) wide.push((i * 37) % 100);
+  std::vector<int> drained = Drain(wide);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(drained[i], 99 - i);
+}
+
+TEST(PriorityQueueTest, push_range) {
+  s21::PriorityQueue<int> q = {10, 20};
+  std::vector<int> few = {15};
+  q.push_range(few.begin(), few.end());
+  std::vector<int> many = {1, 30, 5, 25, 12};
+  q.push_range(many.begin(), many.end());
+  EXPECT_EQ(Drain(q), std::vector<int>({30, 25, 20, 15, 12, 10, 5, 1}));
+}
+
+TEST(PriorityQueueTest, emplace_strings_on_deque) {
+  s21::PriorityQueue<std::string, s21::Deque<std::string>> q;
+  q.emplace(3, 'b');
+  q.emplace("zz");
+  q.emplace("a");
+  EXPECT_EQ(q.top(), "zz");
+  q.pop();
+  EXPECT_EQ(q.top(), "bbb");
+
+  s21::PriorityQueue<std::string, s21::Deque<std::string>> other;
+  other.swap(q);
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(other.size(), 2);
+  s21::PriorityQueue<std::string, s21::Deque<std::string>> moved =
+      std::move(other);
+  EXPECT_EQ(moved.top(), "bbb");
+}
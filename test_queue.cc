@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <queue>
+#include <string>
 
 #include "s21_queue.h"
 
@@ -23,4 +24,14 @@ TEST(QueueTest, queue) {
     EXPECT_EQ(m.front(), i);
     m.pop();
   }
-}
\ No newline at end of file
+}
+TEST(QueueTest, emplace_and_move_front) {
+  s21::Queue<std::string> q;
+  q.emplace(3, 'a');
+  q.push("b");
+  std::string moved = std::move(q.front());
+  EXPECT_EQ(moved, "aaa");
+  q.pop();
+  EXPECT_EQ(q.front(), "b");
+  EXPECT_EQ(q.size(), 1);
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory_resource>
+#include <string>
+
+#include "s21_queue.h"
+#include "s21_ring_buffer.h"
+#include "s21_stack.h"
+
+TEST(RingBufferTest, push_pop_both_ends) {
+  s21::RingBuffer<int> r;
+  std::deque<int> expected;
+  for (int i = 0; i < 100; ++i) {
+    if (i % 2) {
+      r.push_back(i);
+      expected.push_back(i);
+    } else {
+      r.push_front(i);
+      expected.push_front(i);
+    }
+  }
+  EXPECT_EQ(r.size(), 100);
+  EXPECT_EQ(r.capacity(), 128);
+  EXPECT_TRUE(std::equal(r.begin(), r.end(), expected.begin()));
+  for (int i = 0; i < 30; ++i) {
+    r.pop_front();
+    expected.pop_front();
+    r.pop_back();
+    expected.pop_back();
+  }
+  EXPECT_EQ(r.front(), expected.front());
+  EXPECT_EQ(r.back(), expected.back());
+  EXPECT_EQ(r[5], expected[5]);
+  EXPECT_THROW(r.at(40), std::out_of_range);
+}
+
+TEST(RingBufferTest, steady_state_keeps_capacity) {
+  s21::RingBuffer<int> r(10);
+  EXPECT_EQ(r.capacity(), 16);
+  for (int i = 0; i < 10000; ++i) {
+    r.push_back(i);
+    if (r.size() > 12) r.pop_front();
+  }
+  EXPECT_EQ(r.capacity(), 16);
+  EXPECT_EQ(r.front(), 9988);
+  EXPECT_EQ(r.back(), 9999);
+}
+
+TEST(RingBufferTest, overwrite_oldest) {
+  using Ring = s21::RingBuffer<std::string>;
+  Ring r(4, Ring::Overflow::kOverwrite);
+  for (int i = 0; i < 10; ++i) r.push_back(std::to_string(i));
+  EXPECT_TRUE(r.full());
+  EXPECT_EQ(r.capacity(), 4);
+  EXPECT_EQ(r.front(), "6");
+  EXPECT_EQ(r.back(), "9");
+  r.push_front("x");
+  EXPECT_EQ(r.front(), "x");
+  EXPECT_EQ(r.back(), "8");
+
+  Ring copy(r);
+  copy.push_back("y");
+  EXPECT_EQ(copy.capacity(), 4);
+  EXPECT_EQ(copy.front(), "6");
+  EXPECT_THROW(Ring(0, Ring::Overflow::kOverwrite), std::length_error);
+}
+
+TEST(RingBufferTest, push_own_element_when_full) {
+  using Ring = s21::RingBuffer<std::string>;
+  std::string long_a(40, 'a');
+  std::string long_b(40, 'b');
+
+  Ring grow(4);
+  for (int i = 0; i < 4; ++i) grow.push_back(i % 2 ? long_b : long_a);
+  ASSERT_TRUE(grow.full());
+  grow.push_back(grow.front());
+  grow.push_front(grow.back());
+  EXPECT_EQ(grow.back(), long_a);
+  EXPECT_EQ(grow.front(), long_a);
+
+  Ring ring(2, Ring::Overflow::kOverwrite);
+  ring.push_back(long_a);
+  ring.push_back(long_b);
+  ring.push_back(ring.front());
+  EXPECT_EQ(ring.front(), long_b);
+  EXPECT_EQ(ring.back(), long_a);
+  ring.push_front(ring.back());
+  EXPECT_EQ(ring.front(), long_a);
+  EXPECT_EQ(ring.back(), long_b);
+}
+
+TEST(RingBufferTest, copy_move_and_sort) {
+  s21::RingBuffer<int> r = {4, 2, 5, 1, 3};
+  r.pop_front();
+  r.push_back(0);
+  s21::RingBuffer<int> copy = r;
+  std::sort(copy.begin(), copy.end());
+  EXPECT_TRUE(std::is_sorted(copy.begin(), copy.end()));
+  EXPECT_EQ(r.front(), 2);
+
+  s21::RingBuffer<int> moved = std::move(r);
+  EXPECT_EQ(moved.size(), 5);
+  EXPECT_TRUE(r.empty());
+  r = moved;
+  EXPECT_EQ(r.back(), 0);
+  r.clear();
+  EXPECT_TRUE(r.empty());
+}
+
+TEST(RingBufferTest, assignment_keeps_the_resource) {
+  using Buffer = s21::RingBuffer<int, std::pmr::polymorphic_allocator<int>>;
+  std::pmr::monotonic_buffer_resource a;
+  std::pmr::monotonic_buffer_resource b;
+  Buffer source(&a);
+  for (int i = 0; i < 3; ++i) source.push_back(i);
+  Buffer target(&b);
+  target.push_back(10);
+
+  target = source;
+  EXPECT_EQ(target.get_allocator().resource(), &b);
+  ASSERT_EQ(target.size(), 3u);
+  EXPECT_EQ(target.back(), 2);
+
+  target = std::move(source);
+  EXPECT_EQ(target.get_allocator().resource(), &b);
+  ASSERT_EQ(target.size(), 3u);
+  EXPECT_EQ(target.front(), 0);
+
+  Buffer same(&b);
+  same.push_back(7);
+  target.swap(same);
+  EXPECT_EQ(target.front(), 7);
+  EXPECT_EQ(same.size(), 3u);
+  EXPECT_EQ(target.get_allocator().resource(), &b);
+
+  Buffer copy(target, &a);
+  EXPECT_EQ(copy.get_allocator().resource(), &a);
+  Buffer moved(std::move(copy), &b);
+  EXPECT_EQ(moved.get_allocator().resource(), &b);
+  EXPECT_EQ(moved.front(), 7);
+}
+
+TEST(RingBufferTest, queue_and_stack_container) {
+  s21::Queue<int, s21::RingBuffer<int>> q = {1, 2, 3};
+  q.push(4);
+  EXPECT_EQ(q.front(), 1);
+  EXPECT_EQ(q.back(), 4);
+  q.pop();
+  EXPECT_EQ(q.front(), 2);
+  EXPECT_EQ(q.size(), 3);
+
+  s21::Stack<std::string, s21::RingBuffer<std::string>> s = {"a", "b"};
+  s.push("c");
+  EXPECT_EQ(s.top(), "c");
+  s.pop();
+  s.pop();
+  EXPECT_EQ(s.top(), "a");
+  s21::Stack<std::string, s21::RingBuffer<std::string>> other;
+  other.swap(s);
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(other.size(), 1);
+}
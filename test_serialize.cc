@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "s21_serialize.h"
+
+TEST(SerializeTest, vector_raw) {
+  s21::Vector<int> v = {1, 2, 3, 4, 5};
+  std::stringstream ss;
+  s21::serialize(ss, v);
+  EXPECT_EQ(ss.str().size(), 20 + 16 + 5 * sizeof(int) + 16);
+
+  s21::Vector<int> result;
+  s21::deserialize(ss, result);
+  ASSERT_EQ(result.size(), 5);
+  for (size_t i = 0; i < result.size(); ++i) EXPECT_EQ(result[i], v[i]);
+}
+
+TEST(SerializeTest, vector_empty) {
+  s21::Vector<double> v;
+  std::stringstream ss;
+  s21::serialize(ss, v);
+  s21::Vector<double> result = {1.5};
+  s21::deserialize(ss, result);
+  EXPECT_TRUE(result.empty());
+}
+
+TEST(SerializeTest, vector_strings) {
+  s21::Vector<std::string> v = {"hello", "", "world"};
+  std::stringstream ss;
+  s21::serialize(ss, v);
+  s21::Vector<std::string> result;
+  s21::deserialize(ss, result);
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_EQ(result[0], "hello");
+  EXPECT_EQ(result[1], "");
+  EXPECT_EQ(result[2], "world");
+}
+
+TEST(SerializeTest, array) {
+  s21::Array<int, 3> a = {7, 8, 9};
+  std::stringstream ss;
+  s21::serialize(ss, a);
+  s21::Array<int, 3> result;
+  s21::deserialize(ss, result);
+  EXPECT_EQ(result.at(0), 7);
+  EXPECT_EQ(result.at(2), 9);
+
+  std::stringstream again;
+  s21::serialize(again, a);
+  s21::Array<int, 2> small;
+  EXPECT_THROW(s21::deserialize(again, small), std::out_of_range);
+}
+
+TEST(SerializeTest, list) {
+  s21::List<double> l = {1.5, -2.5, 3.25};
+  std::stringstream ss;
+  s21::serialize(ss, l);
+  s21::List<double> result = {9.0};
+  s21::deserialize(ss, result);
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_DOUBLE_EQ(result[0], 1.5);
+  EXPECT_DOUBLE_EQ(result[2], 3.25);
+}
+
+TEST(SerializeTest, deque) {
+  s21::Deque<int> d = {4, 5, 6};
+  std::stringstream ss;
+  s21::serialize(ss, d);
+  s21::Deque<int> result;
+  s21::deserialize(ss, result);
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_EQ(result[0], 4);
+  EXPECT_EQ(result[2], 6);
+}
+
+TEST(SerializeTest, set_sorted_build) {
+  s21::Set<int> s;
+  for (int i = 0; i < 1000; ++i) s.insert((i * 7919) % 1000);
+  std::stringstream ss;
+  s21::serialize(ss, s);
+
+  s21::Set<int> result = {-1};
+  s21::deserialize(ss, result);
+  EXPECT_EQ(result.size(), 1000);
+  EXPECT_FALSE(result.contains(-1));
+  int expected = 0;
+  for (auto value : result) EXPECT_EQ(value, expected++);
+  EXPECT_EQ(expected, 1000);
+}
+
+TEST(SerializeTest, map) {
+  s21::Map<int, std::string> m = {{3, "three"}, {1, "one"}, {2, "two"}};
+  std::stringstream ss;
+  s21::serialize(ss, m);
+  s21::Map<int, std::string> result;
+  s21::deserialize(ss, result);
+  EXPECT_EQ(result.size(), 3);
+  EXPECT_EQ(result.at(1), "one");
+  EXPECT_EQ(result.at(3), "three");
+}
+
+TEST(SerializeTest, chunked_stream) {
+  std::stringstream ss;
+  {
+    s21::ChunkWriter<int> writer(ss, 100);
+    for (int i = 999; i >= 0; --i) writer.write(i);
+  }
+  std::stringstream copy(ss.str());
+
+  s21::ChunkReader<int> reader(ss);
+  std::vector<int> chunk;
+  int chunks = 0, expected = 999;
+  while (reader.next(chunk)) {
+    EXPECT_EQ(chunk.size(), 100);
+    for (int value : chunk) EXPECT_EQ(value, expected--);
+    ++chunks;
+  }
+  EXPECT_EQ(chunks, 10);
+
+  s21::Set<int> s;
+  s21::deserialize(copy, s);
+  EXPECT_EQ(s.size(), 1000);
+  EXPECT_EQ(*s.begin(), 0);
+}
+
+TEST(SerializeTest, bad_input) {
+  std::stringstream garbage("not a container");
+  s21::Vector<int> v;
+  EXPECT_THROW(s21::deserialize(garbage, v), std::runtime_error);
+
+  s21::Vector<int> ints = {1, 2};
+  std::stringstream ss;
+  s21::serialize(ss, ints);
+  s21::Vector<double> doubles;
+  EXPECT_THROW(s21::deserialize(ss, doubles), std::runtime_error);
+}
+
+namespace {
+
+template <class T>
+void Put(std::string &out, T value) {
+  out.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+std::string Header(std::uint16_t flags, std::uint32_t value_size,
+                   std::uint64_t count) {
+  std::string out = "S21C";
+  Put<std::uint16_t>(out, 1);
+  Put(out, flags);
+  Put(out, value_size);
+  Put(out, count);
+  return out;
+}
+
+}  // namespace
+
+TEST(SerializeTest, corrupt_lengths) {
+  // count * sizeof(int) wraps around to the byte length given.
+  std::uint64_t count = (std::uint64_t(1) << 62) + 1;
+  std::string raw = Header(1, sizeof(int), count);
+  Put(raw, count);
+  Put<std::uint64_t>(raw, count * sizeof(int));
+  std::stringstream wrapped(raw);
+  s21::Vector<int> v = {1};
+  EXPECT_THROW(s21::deserialize(wrapped, v), std::runtime_error);
+  EXPECT_EQ(v.size(), 1);
+
+  // A consistent but huge block that the stream does not hold.
+  count = std::uint64_t(1) << 40;
+  raw = Header(1, sizeof(int), count);
+  Put(raw, count);
+  Put<std::uint64_t>(raw, count * sizeof(int));
+  raw.append(64, '\0');
+  std::stringstream missing(raw);
+  EXPECT_THROW(s21::deserialize(missing, v), std::runtime_error);
+
+  // A chunk claiming far more bytes than follow it.
+  std::string chunk = Header(0, 0, 1);
+  Put<std::uint64_t>(chunk, 1);
+  Put<std::uint64_t>(chunk, std::uint64_t(1) << 40);
+  std::stringstream long_chunk(chunk);
+  s21::List<std::string> l;
+  EXPECT_THROW(s21::deserialize(long_chunk, l), std::runtime_error);
+
+  // More values than the chunk has bytes for.
+  chunk = Header(0, 0, s21::serialization::kStreamed);
+  Put<std::uint64_t>(chunk, std::uint64_t(1) << 60);
+  Put<std::uint64_t>(chunk, 8);
+  Put<std::uint64_t>(chunk, 0);
+  std::stringstream many(chunk);
+  s21::ChunkReader<std::string> reader(many);
+  std::vector<std::string> values;
+  EXPECT_THROW(reader.next(values), std::runtime_error);
+
+  // A string length of 2^40 inside a 40-byte file.
+  chunk = Header(0, 0, 1);
+  Put<std::uint64_t>(chunk, 1);
+  Put<std::uint64_t>(chunk, 8);
+  Put<std::uint64_t>(chunk, std::uint64_t(1) << 40);
+  ASSERT_EQ(chunk.size(), 44);
+  std::stringstream long_string(chunk);
+  s21::Vector<std::string> strings;
+  EXPECT_THROW(s21::deserialize(long_string, strings), std::runtime_error);
+}
+
+TEST(SerializeTest, header_count_is_not_trusted) {
+  std::string raw = Header(0, sizeof(int), std::uint64_t(1) << 60);
+  Put<std::uint64_t>(raw, 2);
+  Put<std::uint64_t>(raw, 2 * sizeof(int));
+  Put<int>(raw, 2);
+  Put<int>(raw, 1);
+  Put<std::uint64_t>(raw, 0);
+  Put<std::uint64_t>(raw, 0);
+  std::stringstream ss(raw);
+  s21::Set<int> s;
+  s21::deserialize(ss, s);
+  EXPECT_EQ(s.size(), 2);
+
+  // A raw block larger than the first read step still comes back whole.
+  s21::Vector<int> big;
+  for (int i = 0; i < 100000; ++i) big.push_back(i);
+  std::stringstream block;
+  s21::serialize(block, big);
+  s21::Vector<int> result;
+  s21::deserialize(block, result);
+  ASSERT_EQ(result.size(), big.size());
+  EXPECT_EQ(result[0], 0);
+  EXPECT_EQ(result[99999], 99999);
+}
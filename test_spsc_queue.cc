@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_spsc_queue.h"
+
+TEST(SpscQueueTest, push_pop) {
+  s21::SpscQueue<std::string> q(3);
+  EXPECT_EQ(q.capacity(), 4);
+  EXPECT_TRUE(q.empty());
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(q.try_push(std::to_string(i)));
+  EXPECT_FALSE(q.try_push("full"));
+  EXPECT_EQ(q.size(), 4);
+  EXPECT_EQ(q.front(), "0");
+  q.pop();
+  std::string value;
+  EXPECT_TRUE(q.try_pop(value));
+  EXPECT_EQ(value, "1");
+  q.push("4");
+  q.push("5");
+  for (int i = 2; i < 6; ++i) {
+    EXPECT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, std::to_string(i));
+  }
+  EXPECT_FALSE(q.try_pop(value));
+  EXPECT_THROW(s21::SpscQueue<int>(0), std::length_error);
+}
+
+TEST(SpscQueueTest, batches) {
+  s21::SpscQueue<int> q(8);
+  std::vector<int> in = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  EXPECT_EQ(q.push_n(in.begin(), in.size()), 8);
+  std::vector<int> out(5);
+  EXPECT_EQ(q.pop_n(out.begin(), 5), 5);
+  EXPECT_EQ(out, std::vector<int>({1, 2, 3, 4, 5}));
+  EXPECT_EQ(q.push_n(in.begin() + 8, 2), 2);
+  out.assign(10, 0);
+  EXPECT_EQ(q.pop_n(out.begin(), 10), 5);
+  EXPECT_EQ(out[0], 6);
+  EXPECT_EQ(out[4], 10);
+}
+
+TEST(SpscQueueTest, move_only_and_leftovers) {
+  auto q = std::make_unique<s21::SpscQueue<std::unique_ptr<int>>>(4);
+  q->push(std::make_unique<int>(7));
+  q->push(std::make_unique<int>(8));
+  std::unique_ptr<int> value;
+  EXPECT_TRUE(q->try_pop(value));
+  EXPECT_EQ(*value, 7);
+  q.reset();
+}
+
+TEST(SpscQueueTest, two_threads) {
+  s21::SpscQueue<long> q(1024);
+  const long count = 200000;
+  std::thread producer([&q] {
+    long batch[16];
+    for (long i = 0; i < count;) {
+      if (i % 3 == 0) {
+        q.push(i++);
+        continue;
+      }
+      long n = 0;
+      while (n < 16 && i + n < count) batch[n] = i + n, ++n;
+      long pushed = q.push_n(batch, n);
+      if (pushed == 0) std::this_thread::yield();
+      i += pushed;
+    }
+  });
+  long expected = 0;
+  long buffer[32];
+  while (expected < count) {
+    long value;
+    if (expected % 2 == 0 && q.try_pop(value)) {
+      ASSERT_EQ(value, expected++);
+    } else {
+      long n = q.pop_n(buffer, 32);
+      if (n == 0) std::this_thread::yield();
+      for (long i = 0; i < n; ++i) ASSERT_EQ(buffer[i], expected++);
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(q.empty());
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <string_view>
+
+#include "s21_static_map.h"
+
+namespace {
+
+enum class Opcode { kAdd, kSub, kMul, kDiv, kJmp, kRet };
+
+constexpr auto kOpcodes = s21::MakeStaticMap<std::string_view, Opcode>({
+    {"add", Opcode::kAdd},
+    {"sub", Opcode::kSub},
+    {"mul", Opcode::kMul},
+    {"div", Opcode::kDiv},
+    {"jmp", Opcode::kJmp},
+    {"ret", Opcode::kRet},
+});
+
+static_assert(kOpcodes.size() == 6);
+static_assert(kOpcodes.at("mul") == Opcode::kMul);
+static_assert(*kOpcodes.find("ret") == Opcode::kRet);
+static_assert(!kOpcodes.contains("nop"));
+static_assert(!kOpcodes.contains(""));
+
+constexpr size_t kBig = 1000;
+
+constexpr s21::StaticMap<std::uint32_t, std::uint32_t, kBig> MakeBig() {
+  s21::StaticMapEntry<std::uint32_t, std::uint32_t> items[kBig] = {};
+  for (std::uint32_t i = 0; i < kBig; ++i) items[i] = {i * 7919 + 13, i};
+  return s21::StaticMap<std::uint32_t, std::uint32_t, kBig>(items);
+}
+
+constexpr auto kBigMap = MakeBig();
+static_assert(kBigMap.at(500 * 7919 + 13) == 500);
+
+}  // namespace
+
+TEST(StaticMapTest, lookups) {
+  EXPECT_EQ(kOpcodes.at("jmp"), Opcode::kJmp);
+  std::string key = "div";
+  EXPECT_EQ(kOpcodes.at(key), Opcode::kDiv);
+  EXPECT_EQ(kOpcodes.find("adds"), nullptr);
+  EXPECT_THROW(kOpcodes.at("nop"), std::out_of_range);
+
+  std::set<std::string_view> keys;
+  for (const auto &entry : kOpcodes) keys.insert(entry.first);
+  EXPECT_EQ(keys.size(), 6);
+}
+
+TEST(StaticMapTest, every_key_of_large_table) {
+  for (std::uint32_t i = 0; i < kBig; ++i) {
+    ASSERT_EQ(kBigMap.at(i * 7919 + 13), i);
+    ASSERT_FALSE(kBigMap.contains(i * 7919 + 14));
+  }
+}
+
+TEST(StaticMapTest, duplicate_key_throws) {
+  using Map = s21::StaticMap<int, int, 3>;
+  const Map::value_type items[] = {{1, 1}, {2, 2}, {1, 3}};
+  EXPECT_THROW(Map{items}, std::invalid_argument);
+}
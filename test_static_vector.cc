@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "s21_static_vector.h"
+
+namespace {
+
+struct Counted {
+  static int alive;
+  int value;
+  explicit Counted(int v = 0) : value(v) { ++alive; }
+  Counted(const Counted &other) : value(other.value) { ++alive; }
+  Counted &operator=(const Counted &) = default;
+  ~Counted() { --alive; }
+};
+
+int Counted::alive = 0;
+
+}  // namespace
+
+static_assert(std::is_trivially_copyable_v<s21::StaticVector<int, 8>>);
+static_assert(!std::is_trivially_copyable_v<s21::StaticVector<std::string, 8>>);
+static_assert(sizeof(s21::StaticVector<char, 16>) ==
+              16 + sizeof(std::size_t));
+
+TEST(StaticVectorTest, push_pop_and_capacity) {
+  s21::StaticVector<int, 4> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.capacity(), 4);
+  for (int i = 1; i <= 4; ++i) v.push_back(i * 10);
+  EXPECT_TRUE(v.full());
+  EXPECT_THROW(v.push_back(50), std::length_error);
+  EXPECT_THROW(v.reserve(5), std::length_error);
+  EXPECT_EQ(v.front(), 10);
+  EXPECT_EQ(v.back(), 40);
+  EXPECT_EQ(v.at(2), 30);
+  EXPECT_THROW(v.at(4), std::out_of_range);
+  v.pop_back();
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_THROW((s21::StaticVector<int, 2>{1, 2, 3}), std::length_error);
+}
+
+TEST(StaticVectorTest, insert_erase) {
+  s21::StaticVector<std::string, 8> v = {"a", "c", "e"};
+  v.insert(v.begin() + 1, "b");
+  v.insert(v.begin() + 3, "d");
+  v.insert(v.end(), "f");
+  v.insert(v.begin(), v[5]);
+  EXPECT_EQ(v.size(), 7);
+  std::string joined;
+  for (const auto &s : v) joined += s;
+  EXPECT_EQ(joined, "fabcdef");
+  v.erase(v.begin());
+  v.erase(v.end());
+  v.erase(v.end() - 1);
+  joined.clear();
+  for (const auto &s : v) joined += s;
+  EXPECT_EQ(joined, "abcde");
+}
+
+TEST(StaticVectorTest, unused_slots_are_never_constructed) {
+  {
+    s21::StaticVector<Counted, 100> v;
+    EXPECT_EQ(Counted::alive, 0);
+    v.emplace_back(1);
+    v.emplace_back(2);
+    EXPECT_EQ(Counted::alive, 2);
+    s21::StaticVector<Counted, 100> copy = v;
+    EXPECT_EQ(Counted::alive, 4);
+    copy = s21::StaticVector<Counted, 100>(1);
+    EXPECT_EQ(Counted::alive, 3);
+    copy.swap(v);
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_EQ(v.size(), 1);
+    v.clear();
+    EXPECT_EQ(Counted::alive, 2);
+  }
+  EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(StaticVectorTest, move_only_and_memcpy) {
+  s21::StaticVector<std::unique_ptr<int>, 4> owners;
+  owners.push_back(std::make_unique<int>(5));
+  auto moved = std::move(owners);
+  EXPECT_EQ(*moved.front(), 5);
+
+  s21::StaticVector<int, 8> source = {1, 2, 3};
+  s21::StaticVector<int, 8> target;
+  std::memcpy(static_cast<void *>(&target), &source, sizeof(source));
+  EXPECT_EQ(target.size(), 3);
+  EXPECT_EQ(target[2], 3);
+}
+
+TEST(StaticVectorTest, empty_and_zero_capacity) {
+  s21::StaticVector<std::string, 4> empty;
+  EXPECT_EQ(empty.begin(), empty.end());
+  EXPECT_EQ(empty.data(), empty.begin());
+  int visited = 0;
+  for (const auto &s : empty) visited += static_cast<int>(s.size()) + 1;
+  EXPECT_EQ(visited, 0);
+
+  s21::StaticVector<std::string, 0> none;
+  EXPECT_TRUE(none.empty());
+  EXPECT_EQ(none.capacity(), 0);
+  EXPECT_EQ(none.begin(), none.end());
+  EXPECT_THROW(none.push_back("x"), std::length_error);
+  const auto &cnone = none;
+  EXPECT_EQ(cnone.begin(), cnone.end());
+  EXPECT_NE(cnone.data(), nullptr);
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_binary_tree.h"
+#include "s21_map.h"
+#include "s21_stats.h"
+#include "s21_vector.h"
+
+namespace {
+
+struct ThreadsTestTag {
+  static constexpr const char *kName = "test::Threads";
+};
+
+struct JsonTestTag {
+  static constexpr const char *kName = "test::Json";
+};
+
+struct TreeTestTag {
+  static constexpr const char *kName = "test::Tree";
+};
+
+const s21::stats::TypeStats *Find(const std::vector<s21::stats::TypeStats> &all,
+                                  const std::string &name) {
+  for (const auto &stats : all) {
+    if (stats.name == name) return &stats;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST(StatsTest, histogram_buckets) {
+  using s21::stats::Histogram;
+  const std::uint64_t values[] = {0,    1,         7,          8,
+                                  9,    15,        16,         17,
+                                  1000, 123456789, 1ull << 40, UINT64_MAX};
+  for (std::uint64_t value : values) {
+    std::size_t bucket = Histogram::Bucket(value);
+    ASSERT_LT(bucket, Histogram::kBuckets);
+    EXPECT_LE(Histogram::LowerBound(bucket), value);
+    EXPECT_GE(Histogram::UpperBound(bucket), value);
+    EXPECT_LE(Histogram::UpperBound(bucket) - Histogram::LowerBound(bucket),
+              Histogram::LowerBound(bucket) / 8);
+  }
+  EXPECT_EQ(Histogram::Bucket(UINT64_MAX), Histogram::kBuckets - 1);
+}
+
+TEST(StatsTest, histogram_percentiles) {
+  s21::stats::Histogram histogram;
+  for (std::uint64_t value = 1; value <= 1000; ++value) {
+    histogram.Record(value);
+  }
+  EXPECT_EQ(histogram.Count(), 1000u);
+  EXPECT_EQ(histogram.Max(), 1000u);
+  EXPECT_DOUBLE_EQ(histogram.Mean(), 500.5);
+  EXPECT_NEAR(histogram.Percentile(50), 500, 500 / 8);
+  EXPECT_NEAR(histogram.Percentile(99), 990, 990 / 8);
+  EXPECT_EQ(histogram.Percentile(100), 1000u);
+  EXPECT_EQ(s21::stats::Histogram().Percentile(50), 0u);
+}
+
+TEST(StatsTest, threads_aggregate) {
+  s21::stats::Reset();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([] {
+      s21::stats::Block &block = s21::stats::Local<ThreadsTestTag>();
+      for (int i = 0; i < 1000; ++i) {
+        block.Add(s21::stats::Counter::kComparisons, 2);
+        block.RecordLatency(s21::stats::Op::kFind, 100);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  const auto all = s21::stats::Collect();
+  const s21::stats::TypeStats *stats = Find(all, "test::Threads");
+  ASSERT_NE(stats, nullptr);
+  EXPECT_EQ(stats->count(s21::stats::Counter::kComparisons), 8000u);
+  EXPECT_EQ(stats->latency(s21::stats::Op::kFind).Count(), 4000u);
+  EXPECT_EQ(stats->latency(s21::stats::Op::kFind).Max(), 100u);
+  EXPECT_EQ(stats->latency(s21::stats::Op::kInsert).Count(), 0u);
+}
+
+TEST(StatsTest, json_and_reset) {
+  s21::stats::Reset();
+  s21::stats::Block &block = s21::stats::Local<JsonTestTag>();
+  block.Add(s21::stats::Counter::kReallocations, 3);
+  block.RecordLatency(s21::stats::Op::kErase, 5);
+  std::string json = s21::stats::Json();
+  EXPECT_NE(json.find("\"test::Json\": {\"counters\": {\"comparisons\": 0, "
+                      "\"nodes_visited\": 0, \"reallocations\": 3"),
+            std::string::npos);
+  EXPECT_NE(json.find("\"erase\": {\"count\": 1, \"mean\": 5, \"p50\": 5"),
+            std::string::npos);
+  EXPECT_NE(json.find("\"buckets\": [[5, 1]]"), std::string::npos);
+  EXPECT_EQ(json.front(), '{');
+
+  s21::stats::Reset();
+  const auto all = s21::stats::Collect();
+  const s21::stats::TypeStats *stats = Find(all, "test::Json");
+  ASSERT_NE(stats, nullptr);
+  EXPECT_EQ(stats->count(s21::stats::Counter::kReallocations), 0u);
+  EXPECT_EQ(stats->latency(s21::stats::Op::kErase).Count(), 0u);
+}
+
+TEST(StatsTest, container_hooks) {
+  s21::stats::Reset();
+  s21::BinaryTree<int, std::less<int>, std::allocator<int>, TreeTestTag> tree{
+      4, 2, 6, 1, 3};
+  ASSERT_NE(tree.FindNode(3), nullptr);
+  tree.erase(tree.find(6));
+
+  s21::Vector<int> v;
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+
+  s21::Map<int, int> m;
+  for (int i = 0; i < 4; ++i) m[i] = i;
+  EXPECT_EQ(m.at(3), 3);
+
+  const auto all = s21::stats::Collect();
+  const s21::stats::TypeStats *tree_stats = Find(all, "test::Tree");
+  const s21::stats::TypeStats *vector_stats = Find(all, "s21::Vector");
+  const s21::stats::TypeStats *map_stats = Find(all, "s21::Map");
+#ifdef S21_STATS
+  ASSERT_NE(tree_stats, nullptr);
+  EXPECT_EQ(tree_stats->latency(s21::stats::Op::kInsert).Count(), 5u);
+  EXPECT_EQ(tree_stats->latency(s21::stats::Op::kErase).Count(), 1u);
+  // FindNode(3) and find(6) pass 4, 2, 3 and 4, 6.
+  EXPECT_EQ(tree_stats->latency(s21::stats::Op::kFind).Count(), 2u);
+  EXPECT_EQ(tree_stats->nodes_per_find.Max(), 3u);
+  EXPECT_EQ(tree_stats->nodes_per_find.Count(), 2u);
+
+  ASSERT_NE(vector_stats, nullptr);
+  // Capacity goes 1, 2, ..., 128, moving 0 + 1 + ... + 64 elements.
+  EXPECT_EQ(vector_stats->count(s21::stats::Counter::kReallocations), 8u);
+  EXPECT_EQ(vector_stats->count(s21::stats::Counter::kBytesMoved),
+            127 * sizeof(int));
+
+  ASSERT_NE(map_stats, nullptr);
+  EXPECT_EQ(map_stats->latency(s21::stats::Op::kInsert).Count(), 4u);
+  // The lookup at the end scans keys 0 to 3.
+  EXPECT_EQ(map_stats->nodes_per_find.Max(), 4u);
+#else
+  EXPECT_FALSE(s21::stats::kEnabled);
+  EXPECT_EQ(tree_stats, nullptr);
+  EXPECT_EQ(vector_stats, nullptr);
+  EXPECT_EQ(map_stats, nullptr);
+#endif
+}
@@ -0,0 +1,331 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "s21_unrolled_list.h"
+
+namespace {
+
+// Labelled allocator that counts its allocations and the blocks still live.
+// All instances compare equal, so the label only shows which one a list
+// ended up with.
+template <class T>
+struct LabelledAllocator {
+  using value_type = T;
+  using propagate_on_container_swap = std::false_type;
+
+  explicit LabelledAllocator(int label = 0)
+      : label(label),
+        allocations(std::make_shared<int>(0)),
+        live(std::make_shared<int>(0)) {}
+
+  template <class U>
+  LabelledAllocator(const LabelledAllocator<U> &other)
+      : label(other.label), allocations(other.allocations), live(other.live) {}
+
+  T *allocate(std::size_t n) {
+    ++*allocations;
+    ++*live;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *ptr, std::size_t n) {
+    --*live;
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  LabelledAllocator select_on_container_copy_construction() const {
+    return LabelledAllocator(label + 100);
+  }
+
+  friend bool operator==(const LabelledAllocator &, const LabelledAllocator &) {
+    return true;
+  }
+
+  friend bool operator!=(const LabelledAllocator &, const LabelledAllocator &) {
+    return false;
+  }
+
+  int label;
+  std::shared_ptr<int> allocations;
+  std::shared_ptr<int> live;
+};
+
+}  // namespace
+
+class TestUnrolledList : public testing::Test {
+ protected:
+  std::list<int> list = {1, 6, 3, 2, 5, 5};
+  std::list<int> list_2 = {5, 4, 3, 2, 1};
+
+  s21::UnrolledList<int, 4> test = {1, 6, 3, 2, 5, 5};
+  s21::UnrolledList<int, 4> test_2 = {5, 4, 3, 2, 1};
+
+  template <class L>
+  void ExpectEqual(const std::list<int> &expected, L &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    auto it = actual.begin();
+    for (int value : expected) {
+      EXPECT_EQ(value, *it);
+      ++it;
+    }
+    EXPECT_TRUE(it == actual.end());
+    auto rit = actual.end();
+    for (auto std_rit = expected.rbegin(); std_rit != expected.rend();
+         ++std_rit) {
+      --rit;
+      EXPECT_EQ(*std_rit, *rit);
+    }
+  }
+};
+
+TEST_F(TestUnrolledList, constructors) {
+  s21::UnrolledList<int, 4> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.size(), 0);
+  ExpectEqual(list, test);
+
+  s21::UnrolledList<int, 4> copy(test);
+  ExpectEqual(list, copy);
+  s21::UnrolledList<int, 4> moved(std::move(copy));
+  ExpectEqual(list, moved);
+  EXPECT_TRUE(copy.empty());
+
+  s21::UnrolledList<int, 4> sized(5);
+  EXPECT_EQ(sized.size(), 5);
+  EXPECT_EQ(sized[4], 0);
+}
+
+TEST_F(TestUnrolledList, push_pop) {
+  for (int i = 0; i < 50; ++i) {
+    test.push_back(i);
+    list.push_back(i);
+    test.push_front(-i);
+    list.push_front(-i);
+  }
+  ExpectEqual(list, test);
+  for (int i = 0; i < 30; ++i) {
+    test.pop_back();
+    list.pop_back();
+    test.pop_front();
+    list.pop_front();
+  }
+  ExpectEqual(list, test);
+  EXPECT_EQ(test.front(), list.front());
+  EXPECT_EQ(test.back(), list.back());
+}
+
+TEST_F(TestUnrolledList, insert_erase) {
+  unsigned seed = 7;
+  for (int i = 0; i < 2000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    size_t at = list.empty() ? 0 : seed % (list.size() + 1);
+    auto it = test.begin();
+    auto std_it = list.begin();
+    for (size_t k = 0; k < at; ++k, ++it, ++std_it) {
+    }
+    if (seed % 3 == 0 && std_it != list.end()) {
+      auto next = test.erase(it);
+      auto std_next = list.erase(std_it);
+      if (std_next != list.end()) {
+        EXPECT_EQ(*next, *std_next);
+      }
+    } else {
+      auto inserted = test.insert(it, i);
+      list.insert(std_it, i);
+      EXPECT_EQ(*inserted, i);
+    }
+  }
+  ExpectEqual(list, test);
+}
+
+TEST_F(TestUnrolledList, reverse) {
+  for (int i = 0; i < 20; ++i) {
+    test.push_back(i);
+    list.push_back(i);
+  }
+  test.reverse();
+  list.reverse();
+  ExpectEqual(list, test);
+}
+
+TEST_F(TestUnrolledList, unique_sort) {
+  test.unique();
+  list.unique();
+  ExpectEqual(list, test);
+  test.sort();
+  list.sort();
+  ExpectEqual(list, test);
+  test.sort(std::greater<int>());
+  list.sort(std::greater<int>());
+  ExpectEqual(list, test);
+}
+
+TEST_F(TestUnrolledList, merge) {
+  test.sort();
+  list.sort();
+  test_2.sort();
+  list_2.sort();
+  test.merge(test_2);
+  list.merge(list_2);
+  ExpectEqual(list, test);
+  EXPECT_TRUE(test_2.empty());
+}
+
+TEST_F(TestUnrolledList, merge_relinks_nodes) {
+  using Item = std::pair<int, int>;
+  auto by_key = [](const Item &a, const Item &b) { return a.first < b.first; };
+  std::mt19937 rng(7);
+  for (int round = 0; round < 50; ++round) {
+    LabelledAllocator<Item> alloc;
+    s21::UnrolledList<Item, 4, LabelledAllocator<Item>> a(alloc);
+    s21::UnrolledList<Item, 4, LabelledAllocator<Item>> b(alloc);
+    std::list<Item> expected_a;
+    std::list<Item> expected_b;
+    int size_a = static_cast<int>(rng() % 40);
+    int size_b = static_cast<int>(rng() % 40);
+    for (int i = 0; i < size_a; ++i) {
+      expected_a.push_back({static_cast<int>(rng() % 20), 0});
+    }
+    for (int i = 0; i < size_b; ++i) {
+      expected_b.push_back({static_cast<int>(rng() % 20), 1});
+    }
+    expected_a.sort(by_key);
+    expected_b.sort(by_key);
+    for (const Item &item : expected_a) a.push_back(item);
+    for (const Item &item : expected_b) b.push_back(item);
+
+    int before = *alloc.allocations;
+    a.merge(b, by_key);
+    expected_a.merge(expected_b, by_key);
+    EXPECT_LE(*alloc.allocations - before, 2);
+    EXPECT_TRUE(b.empty());
+    ASSERT_EQ(a.size(), expected_a.size());
+    auto it = a.begin();
+    for (const Item &item : expected_a) EXPECT_EQ(*it++, item);
+    EXPECT_TRUE(it == a.end());
+  }
+
+  // Disjoint ranges keep every element where it was.
+  s21::UnrolledList<int, 4> low = {1, 2, 3, 4, 5, 6, 7, 8};
+  s21::UnrolledList<int, 4> high = {10, 11, 12, 13};
+  const int *first_low = &*low.begin();
+  const int *first_high = &*high.begin();
+  low.merge(high);
+  EXPECT_EQ(&*low.begin(), first_low);
+  auto ten = low.begin();
+  while (*ten != 10) ++ten;
+  EXPECT_EQ(&*ten, first_high);
+  EXPECT_EQ(low.size(), 12);
+}
+
+TEST_F(TestUnrolledList, erase_keeps_nodes_half_full) {
+  LabelledAllocator<int> alloc;
+  s21::UnrolledList<int, 16, LabelledAllocator<int>> sparse(alloc);
+  for (int i = 0; i < 16000; ++i) sparse.push_back(i);
+  EXPECT_EQ(*alloc.live, 1000);
+  auto it = sparse.begin();
+  for (int i = 0; i < 16000; ++i) {
+    if (i % 16 == 0) {
+      EXPECT_EQ(*it, i);
+      ++it;
+    } else {
+      it = sparse.erase(it);
+    }
+  }
+  EXPECT_TRUE(it == sparse.end());
+  ASSERT_EQ(sparse.size(), 1000);
+  EXPECT_LE(*alloc.live, 1000 / 8 + 1);
+  int expected = 0;
+  for (int value : sparse) {
+    EXPECT_EQ(value, expected);
+    expected += 16;
+  }
+
+  // Erasing backwards from the end leans on the previous node instead.
+  while (sparse.size() > 500) sparse.pop_back();
+  for (auto back = --sparse.end(); sparse.size() > 10;) {
+    auto prev = back;
+    --prev;
+    sparse.erase(prev);
+    back = --sparse.end();
+  }
+  EXPECT_LE(*alloc.live, 2);
+  EXPECT_EQ(sparse.back(), 499 * 16);
+  EXPECT_EQ(sparse.front(), 0);
+}
+
+TEST_F(TestUnrolledList, sort_uses_the_allocator) {
+  LabelledAllocator<int> alloc;
+  s21::UnrolledList<int, 4, LabelledAllocator<int>> l(alloc);
+  for (int i = 0; i < 100; ++i) l.push_back((i * 37) % 100);
+  int before = *alloc.allocations;
+  l.sort();
+  EXPECT_EQ(*alloc.allocations, before + 1);
+  int expected = 0;
+  for (int value : l) EXPECT_EQ(value, expected++);
+}
+
+TEST_F(TestUnrolledList, allocator_propagation) {
+  using List = s21::UnrolledList<int, 4, LabelledAllocator<int>>;
+  List a(LabelledAllocator<int>(1));
+  List b(LabelledAllocator<int>(2));
+  a.push_back(1);
+  b.push_back(2);
+  a.swap(b);
+  EXPECT_EQ(a.get_allocator().label, 1);
+  EXPECT_EQ(b.get_allocator().label, 2);
+  EXPECT_EQ(a.front(), 2);
+
+  List copy(a);
+  EXPECT_EQ(copy.get_allocator().label, 101);
+  EXPECT_EQ(copy.front(), 2);
+  List moved(std::move(copy));
+  EXPECT_EQ(moved.get_allocator().label, 101);
+}
+
+TEST_F(TestUnrolledList, splice) {
+  test.splice(++test.begin(), test_2);
+  list.splice(++list.begin(), list_2);
+  ExpectEqual(list, test);
+  EXPECT_TRUE(test_2.empty());
+
+  s21::UnrolledList<int, 4> other = {7, 8, 9};
+  std::list<int> std_other = {7, 8, 9};
+  test.splice(test.end(), other, ++other.begin());
+  list.splice(list.end(), std_other, ++std_other.begin());
+  ExpectEqual(list, test);
+  ExpectEqual(std_other, other);
+
+  auto first = test.begin();
+  auto last = first;
+  for (int i = 0; i < 3; ++i) ++last;
+  test.splice(test.end(), test, first, last);
+  list.splice(list.end(), list, list.begin(), std::next(list.begin(), 3));
+  ExpectEqual(list, test);
+}
+
+TEST_F(TestUnrolledList, strings) {
+  s21::UnrolledList<std::string, 3> words;
+  std::list<std::string> std_words;
+  for (int i = 0; i < 40; ++i) {
+    words.insert(words.begin(), std::to_string(i));
+    std_words.insert(std_words.begin(), std::to_string(i));
+  }
+  words.sort();
+  std_words.sort();
+  auto it = words.begin();
+  for (auto &word : std_words) EXPECT_EQ(word, *it++);
+  words.clear();
+  EXPECT_TRUE(words.empty());
+}
+
+TEST_F(TestUnrolledList, node_overhead) {
+  using Node = s21::UnrolledList<int>::Node;
+  EXPECT_EQ(sizeof(Node), 3 * sizeof(void *) + 16 * sizeof(int));
+}
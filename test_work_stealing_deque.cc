@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "s21_work_stealing_deque.h"
+
+TEST(WorkStealingDequeTest, owner_is_lifo_thief_is_fifo) {
+  s21::WorkStealingDeque<int> d(2);
+  EXPECT_EQ(d.capacity(), 2);
+  int value = -1;
+  EXPECT_FALSE(d.pop_bottom(value));
+  EXPECT_FALSE(d.steal_top(value));
+  EXPECT_EQ(value, -1);
+  for (int i = 0; i < 10; ++i) d.push_bottom(i);
+  EXPECT_EQ(d.size(), 10);
+  EXPECT_EQ(d.capacity(), 16);
+  EXPECT_TRUE(d.steal_top(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(d.pop_bottom(value));
+  EXPECT_EQ(value, 9);
+  EXPECT_TRUE(d.steal_top(value));
+  EXPECT_EQ(value, 1);
+  while (d.pop_bottom(value)) {
+  }
+  EXPECT_EQ(value, 2);
+  EXPECT_TRUE(d.empty());
+  EXPECT_THROW(s21::WorkStealingDeque<int>(0), std::length_error);
+}
+
+TEST(WorkStealingDequeTest, wraps_around) {
+  s21::WorkStealingDeque<int> d(4);
+  int value;
+  for (int lap = 0; lap < 100; ++lap) {
+    d.push_bottom(lap);
+    d.push_bottom(lap + 1);
+    EXPECT_TRUE(d.steal_top(value));
+    EXPECT_EQ(value, lap);
+    EXPECT_TRUE(d.pop_bottom(value));
+    EXPECT_EQ(value, lap + 1);
+  }
+  EXPECT_EQ(d.capacity(), 4);
+}
+
+// The owner pushes in bursts, growing the ring, and pops some back while
+// thieves drain from the top. Every item must come out exactly once.
+TEST(WorkStealingDequeTest, stress_every_item_once) {
+  const int items = 100000, thieves = 3;
+  s21::WorkStealingDeque<int> d(8);
+  std::vector<std::atomic<int>> seen(items);
+  std::atomic<bool> done(false);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thieves; ++t) {
+    threads.emplace_back([&] {
+      int value;
+      while (!done.load() || !d.empty()) {
+        if (d.steal_top(value)) {
+          seen[value].fetch_add(1);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  int value;
+  for (int next = 0; next < items;) {
+    for (int burst = 0; burst < 64 && next < items; ++burst) {
+      d.push_bottom(next++);
+    }
+    for (int pops = 0; pops < 16 && d.pop_bottom(value); ++pops) {
+      seen[value].fetch_add(1);
+    }
+    if (next % 1024 == 0) std::this_thread::yield();
+  }
+  while (d.pop_bottom(value)) seen[value].fetch_add(1);
+  done.store(true);
+  for (auto &thread : threads) thread.join();
+  for (int i = 0; i < items; ++i) ASSERT_EQ(seen[i].load(), 1) << i;
+}